@@ -46,6 +46,12 @@
 	
 	You'll need to include the "Pixie_Icon_Pack.h" file to use the built-in
 	pack, as seen below.
+	
+	Each icon in "Pixie_Icon_Pack.h" takes 5 bytes of RAM. On an Arduino
+	Uno the whole pack is over half of the 2KB! "Pixie_Icon_Pack_P.h" has
+	the same icons packed in flash instead, with an ID for each one:
+	
+	pix.print(PIX_ICONS, PIX_ICON_HEART);
 */
 
 #include "Pixie.h"
@@ -11,6 +11,7 @@
   
   1.0.0  = pix.begin(LEGACY_SPEED) // ~ 39kHz bitrate
   1.1.0+ = pix.begin(FULL_SPEED)   // ~ 67kHz bitrate (Firmware 1.1.0+)
+  1.4.0 USI = pix.begin(USI_SPEED) // ~250kHz bitrate (PRO_CRC, USI-wired boards only)
 */
 
 #include "Pixie.h"
@@ -0,0 +1,42 @@
+/*
+	Pixie SCROLLER Example
+	-----------------------
+	
+	Unlike pix.scroll_message(), a PixieScroller
+	doesn't block. Call scroller.update() as often
+	as you can from loop() and it pushes in however
+	many columns are due, so the scroll speed stays
+	the same no matter how many Pixies are chained.
+	
+	Other code keeps running while the message moves.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Scroller.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieScroller scroller(pix);              // Scrolls text on "pix"
+
+bool smooth = true;
+
+void setup() {
+  pinMode(LED_BUILTIN, OUTPUT);
+  pix.begin(); // Init display drivers
+}
+
+void loop() {
+  if(scroller.done()){
+    if(smooth){
+      scroller.begin("Hello, from your new PIXIES!", 50);       // 50 columns per second
+    }
+    else{
+      scroller.begin("Hello, from your new PIXIES!", 40, true); // One character at a time
+    }
+    smooth = !smooth;
+  }
+  scroller.update(); // Calls pix.show() when the message moved
+
+  digitalWrite(LED_BUILTIN, (millis() / 500) % 2); // Still blinking while scrolling
+}
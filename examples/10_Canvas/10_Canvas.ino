@@ -0,0 +1,50 @@
+/*
+	Pixie CANVAS Example
+	-----------------------
+	
+	pix.canvas(width) gives you an off-screen
+	drawing area wider than your Pixie chain.
+	Draw into it once, then move the viewport
+	with pix.set_view() / pix.move_view() and
+	call pix.show() - no text is re-rendered.
+	
+	PIX_WRAP repeats the canvas endlessly (marquee),
+	PIX_CLAMP stops at the edges (bounce).
+*/
+
+#include "Pixie.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+int8_t dir = 1;
+
+void setup() {
+  pix.begin(); // Init display drivers
+
+  pix.canvas(40 * 5);                                    // 40 characters wide
+  pix.write("Drawn once, scrolled by the viewport! ", 0); // Drawn into the canvas
+}
+
+void loop() {
+  // Marquee: 5 laps around the canvas
+  pix.set_view_mode(PIX_WRAP);
+  for (uint16_t i = 0; i < 40 * 5 * 5; i++) {
+    pix.move_view(1);
+    pix.show();
+    delay(10);
+  }
+
+  // Bounce between the canvas edges 4 times
+  pix.set_view_mode(PIX_CLAMP);
+  uint8_t bounces = 0;
+  while (bounces < 4) {
+    if (pix.move_view(dir)) { // true when an edge was hit
+      dir = -dir;
+      bounces++;
+    }
+    pix.show();
+    delay(10);
+  }
+}
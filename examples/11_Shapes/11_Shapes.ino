@@ -0,0 +1,54 @@
+/*
+	Pixie SHAPES Example
+	-----------------------
+	
+	Lines, rectangles and circles are drawn a
+	whole column (or a run of columns) at a time,
+	so they are much faster than pix.set_pix()
+	in a loop. x counts columns from the left of
+	the chain, y counts rows (0-6) from the top.
+	
+	The last argument turns pixels on (1, default)
+	or off (0).
+*/
+
+#include "Pixie.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+void setup() {
+  pix.begin(); // Init display drivers
+}
+
+void loop() {
+  uint8_t width = NUM_PIXIES * 10; // Columns in the chain
+
+  // Bouncing ball inside a frame
+  for (int16_t x = 3; x < width - 3; x++) {
+    pix.clear();
+    pix.draw_rect(0, 0, width, 7);
+    pix.fill_circle(x, 3, 2);
+    pix.show();
+    delay(20);
+  }
+
+  // Sweep a line across
+  for (int16_t x = 0; x < width; x++) {
+    pix.clear();
+    pix.draw_line(x, 0, width - 1 - x, 6);
+    pix.show();
+    delay(20);
+  }
+
+  // Fill, then punch rows out of it
+  pix.fill_rect(0, 0, width, 7);
+  pix.show();
+  delay(500);
+  for (int16_t y = 0; y < 7; y += 2) {
+    pix.draw_hline(0, y, width, 0);
+    pix.show();
+    delay(200);
+  }
+}
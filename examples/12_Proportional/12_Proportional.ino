@@ -0,0 +1,44 @@
+/*
+	Pixie PROPORTIONAL FONT Example
+	--------------------------------
+	
+	PIX_FONT_PROP is the built-in font with each
+	glyph trimmed to its own width, so a '1' or ':'
+	takes 2-3 columns instead of 5. Text can start
+	at any column, not only on a 5x7 matrix, and
+	pairs like "Te" or "LT" are kerned closer.
+	
+	A clock drawn this way is a bit narrower, and
+	scrolled text with narrow glyphs passes sooner.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Scroller.h"
+#define NUM_PIXIES  3                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieScroller scroller(pix);              // Scrolls text on "pix"
+
+void setup() {
+  pix.begin(); // Init display drivers
+}
+
+void loop() {
+  char clock_text[9];
+  uint32_t t = millis() / 1000;
+  sprintf(clock_text, "%02lu:%02lu", (t / 60) % 60, t % 60);
+
+  pix.clear();
+  uint16_t width = pix.text_width(clock_text, PIX_FONT_PROP);
+  pix.draw_text(clock_text, (pix.display_count()*5 - width) / 2, PIX_FONT_PROP); // Centered
+  pix.show();
+  delay(200);
+
+  if(t % 20 == 19){
+    scroller.begin("Time flies: 11:11", PIX_FONT_PROP, 40);
+    while(!scroller.done()){
+      scroller.update();
+    }
+  }
+}
@@ -0,0 +1,40 @@
+/*
+	Pixie UTF-8 TEXT Example
+	--------------------------------
+	
+	Strings are UTF-8, so "é" or "→" takes one
+	position on the display, not one per byte.
+	ASCII is drawn from the built-in font as before.
+	
+	Everything else is looked up in an extended
+	glyph set: font_ext.h has Latin-1, some of
+	Latin Extended-A, Greek, arrows, box drawing
+	and block elements (~1.4KB of flash). Without
+	set_glyphs(), those characters show as spaces.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Scroller.h"
+#include "font_ext.h"                     // PIX_GLYPHS_EXT
+#define NUM_PIXIES  3                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieScroller scroller(pix);              // Scrolls text on "pix"
+
+void setup() {
+  pix.begin();                  // Init display drivers
+  pix.set_glyphs(PIX_GLYPHS_EXT); // Characters beyond ASCII
+}
+
+void loop() {
+  pix.clear();
+  pix.write("21°C ↑");          // 6 characters, 9 bytes
+  pix.show();
+  delay(2000);
+
+  scroller.begin("Grüße aus Köln · Ωμεγα · £5 → €6", PIX_FONT_PROP, 40);
+  while(!scroller.done()){
+    scroller.update();
+  }
+}
@@ -0,0 +1,46 @@
+/*
+	Pixie PRINT Example
+	--------------------------------
+	
+	PixiePrint is an Arduino Print, so everything
+	Serial.print() can do works on the displays too:
+	F("...") strings straight from flash, numbers
+	in any base, Strings and println(). Libraries that
+	print to a "Print&" can print to it as well.
+	
+	Each character goes straight to its glyph, with
+	no buffer in between. Call show() when done.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Print.h"
+#define NUM_PIXIES  3                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixiePrint out(pix);                      // Prints to "pix" at its cursor
+PixiePrint ticker(pix, PIX_PRINT_PUSH);   // Prints to "pix" from the right
+
+void setup() {
+  pix.begin(); // Init display drivers
+}
+
+void loop() {
+  pix.clear();
+  out.println(F("Up: "));   // '\n' returns to position 0
+  out.print(millis() / 1000);
+  pix.show();
+  delay(1000);
+
+  pix.clear();
+  out.print(F("0x"));
+  out.print(millis() & 0xFFFF, HEX);
+  pix.show();
+  delay(1000);
+
+  for(uint8_t i = 0; i < 6; i++){
+    ticker.print(i);        // Each digit pushes the others left
+    pix.show();
+    delay(250);
+  }
+}
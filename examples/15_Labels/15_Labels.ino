@@ -0,0 +1,45 @@
+/*
+	Pixie LABELS Example
+	--------------------------------
+	
+	PIXIE_TEXT() turns a string into display
+	columns while the sketch compiles, and keeps
+	them in flash. Drawing a label is then one
+	copy: no glyph lookups and no string in RAM.
+	
+	Use it for text that never changes, like
+	units and menu items, and write the changing
+	numbers next to it as usual.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Text.h"
+#define NUM_PIXIES  3                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+constexpr auto FPS_LABEL  PROGMEM = PIXIE_TEXT("FPS");
+constexpr auto TEMP_LABEL PROGMEM = PIXIE_TEXT("\xC2\xB0" "C"); // UTF-8 works too
+
+void setup() {
+  pix.begin(); // Init display drivers
+}
+
+void loop() {
+  uint16_t frames = 0;
+  uint32_t t_end = millis() + 1000;
+  while(millis() < t_end){
+    pix.clear();
+    pix.write(frames);        // Number at position 0...
+    pix.write(FPS_LABEL, 3);  // ...label at position 3
+    pix.show();
+    frames++;
+  }
+
+  pix.clear();
+  pix.write(21);
+  pix.write(TEMP_LABEL, 2);
+  pix.show();
+  delay(2000);
+}
@@ -0,0 +1,41 @@
+/*
+	Pixie FADE Example
+	--------------------------------
+	
+	PixieFader fades brightness without blocking,
+	each module to its own level if you like.
+	update() only changes the levels in the display
+	buffer, and the show() you call anyway sends
+	them: fading costs no extra frames.
+	
+	Here a bright spot sweeps along the chain
+	while the text keeps updating.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Fader.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieFader fader(pix);                    // Fades "pix"
+
+uint8_t spot = 0;
+
+void setup() {
+  pix.begin(); // Init display drivers
+  pix.brightness(10);
+}
+
+void loop() {
+  if(fader.done()){ // Move the spot on once the last fade is over
+    fader.fade_to(10, 400, PIX_EASE_OUT, spot);
+    spot = (spot + 1) % NUM_PIXIES;
+    fader.fade_to(127, 400, PIX_EASE_IN, spot);
+  }
+  fader.update();
+
+  pix.clear();
+  pix.write(millis());
+  pix.show();
+}
@@ -0,0 +1,36 @@
+/*
+	Pixie GRAYSCALE Example
+	--------------------------------
+	
+	Pixies only have one brightness per module, but
+	PixieGray fakes per-pixel levels by flashing bit
+	planes: plane 1 stays up twice as long as plane 0,
+	and so on, so each pixel is lit for a share of the
+	time that matches its level.
+	
+	That takes a fast chain: Pixie Pro modules on
+	firmware 1.4.0 USI at USI_SPEED, and only a few of
+	them. With 3 modules, 4 levels refresh at over
+	100 Hz. Longer chains flicker unless you use fewer
+	levels (see extras/emulator/README.md).
+*/
+
+#include "Pixie.h"
+#include "Pixie_Gray.h"
+#define NUM_PIXIES  3                              // PCBs, not matrices
+#define CLK_PIN     4                              // Any digital pin
+#define DATA_PIN    5                              // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN, PRO_CRC); // Set up display buffer
+PixieGray gray(pix, 2);                            // 2 bits per pixel: 4 levels
+
+void setup() {
+  pix.begin(USI_SPEED); // Init display drivers
+  for(int16_t x = 0; x < NUM_PIXIES*10; x++){
+    gray.put_column(x, 0x7F, x * gray.levels() / (NUM_PIXIES*10)); // Dark to bright
+  }
+  gray.draw_text("Hi!", 8, 0); // Dark text over the gradient
+}
+
+void loop() {
+  gray.update(); // Instead of pix.show(), as often as possible
+}
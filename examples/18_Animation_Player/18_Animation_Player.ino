@@ -0,0 +1,54 @@
+/*
+	Pixie ANIMATION PLAYER Example
+	--------------------------------
+	
+	The spinner from 07_Animation, stored the way
+	extras/pack_animation.py packs it: the first frame,
+	then only the columns that change from each frame
+	to the next. 65 bytes of flash instead of 120, and
+	long animations save far more.
+	
+	PixiePlayer runs it from loop() without delay(),
+	so the rest of the sketch keeps going. Each frame
+	only touches its changed columns, and show_changes()
+	only encodes their module, or sends nothing if the
+	player didn't move on.
+	
+	To pack your own, save the frames as a 2D array
+	like the one in 07_Animation and run:
+	python3 extras/pack_animation.py --ms 40 frames.h PIX_ANIM_SPIN
+*/
+
+#include "Pixie.h"
+#include "Pixie_Player.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixiePlayer player(pix);
+
+// Generated by extras/pack_animation.py --ms 40
+// 24 frames, 5 columns each, keyframe + XOR deltas: 65 bytes of flash instead of 120.
+
+const uint8_t pix_anim_spin_data[65] PROGMEM = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x11, 0x01, 0x02,
+	0x12, 0x01, 0x04, 0x14, 0x01, 0x08, 0x18, 0x01, 0x10, 0x10, 0x21, 0x10, 0x42, 0x18, 0x40, 0x04,
+	0x14, 0x40, 0x08, 0x12, 0x40, 0x10, 0x11, 0x40, 0x20, 0x11, 0x20, 0x40, 0x09, 0x10, 0x40, 0x05,
+	0x08, 0x40, 0x03, 0x04, 0x40, 0x01, 0x42, 0x01, 0x21, 0x01, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+	0x02,
+};
+
+const PixieAnimation PIX_ANIM_SPIN = {pix_anim_spin_data, NULL, 24, 40, 5};
+
+void setup() {
+  pix.begin(); // Init display drivers
+  pix.write("Loading"); // Stays put, the spinner only changes the last position
+  player.begin(PIX_ANIM_SPIN, (NUM_PIXIES*2 - 1) * 5);
+  pix.show();
+}
+
+void loop() {
+  if(player.update()){ // True when the frame changed
+    pix.show_changes();
+  }
+}
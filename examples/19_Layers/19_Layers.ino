@@ -0,0 +1,63 @@
+/*
+	Pixie LAYERS Example
+	--------------------------------
+	
+	A clock sign: the time on the left, a ticker
+	scrolling on the right, and every 10 seconds a
+	notification that covers both for a moment.
+	
+	Each part is a PixieLayer with its own columns,
+	so the ticker scrolling doesn't redraw the time,
+	and popping the notification brings back what was
+	under it without drawing any of it again.
+	layers.show() only composes the columns that
+	changed.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Layers.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+PixieLayers layers(pix);
+PixieLayer clock_field(pix, 0, 25);       // Positions 0-4
+PixieLayer ticker(pix, 30, 30, 200);      // Positions 6-11, 200 columns of news
+PixieLayer note(pix, 10, 40);             // Positions 2-9, when pushed
+
+uint32_t last_step = 0;
+uint32_t last_second = 0;
+uint16_t seconds = 0;
+
+void setup() {
+  pix.begin(); // Init display drivers
+  ticker.draw_text("Rain at 5pm - ", 0);
+  note.draw_text("MEETING!", 0);
+  layers.add(clock_field);
+  layers.add(ticker);
+}
+
+void loop() {
+  if(millis() - last_second >= 1000){
+    last_second += 1000;
+    seconds++;
+    char time[6] = "00:00";
+    time[0] += seconds / 600 % 10;
+    time[1] += seconds / 60 % 10;
+    time[3] += seconds / 10 % 6;
+    time[4] += seconds % 10;
+    clock_field.draw_text(time, 0); // Only the digits that changed mark columns
+    if(seconds % 10 == 0){
+      layers.push(note);
+    }
+    else if(seconds % 10 == 2){
+      layers.pop();
+    }
+  }
+  if(millis() - last_step >= 50){
+    last_step += 50;
+    ticker.scroll(1);
+  }
+  layers.show(); // Composes and sends only if something changed
+}
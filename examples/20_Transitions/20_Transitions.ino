@@ -0,0 +1,55 @@
+/*
+	Pixie TRANSITIONS Example
+	--------------------------------
+	
+	Counts seconds on a 6-module clock face, changing
+	from each second to the next with a different
+	effect: the digits roll up or down, wipe across,
+	dissolve, or flip over like a split-flap clock
+	(only the digits that change flip).
+	
+	PixieTransition runs from loop() without delay():
+	capture() the old frame, draw the new one, then
+	begin() the effect and keep calling update().
+*/
+
+#include "Pixie.h"
+#include "Pixie_Transition.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieTransition trans(pix);
+
+uint8_t effects[] = {PIX_ROLL_UP, PIX_ROLL_DOWN, PIX_WIPE_RIGHT, PIX_WIPE_LEFT, PIX_DISSOLVE, PIX_FLIP};
+uint32_t last_second = 0;
+uint16_t seconds = 0;
+
+void draw_time(){
+  char time[13] = "   00:00    ";
+  time[3] += seconds / 600 % 10;
+  time[4] += seconds / 60 % 10;
+  time[6] += seconds / 10 % 6;
+  time[7] += seconds % 10;
+  pix.write(time, 0);
+}
+
+void setup() {
+  pix.begin(); // Init display drivers
+  draw_time();
+  pix.show();
+}
+
+void loop() {
+  if(millis() - last_second >= 1000){
+    last_second += 1000;
+    trans.stop();        // In case the last one is still running
+    trans.capture();     // The old time
+    seconds++;
+    draw_time();         // The new one
+    trans.begin(effects[seconds % 6], 400);
+  }
+  if(trans.update()){    // True when a step changed the display buffer
+    pix.show_changes();
+  }
+}
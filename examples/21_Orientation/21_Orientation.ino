@@ -0,0 +1,37 @@
+/*
+	Pixie ORIENTATION Example
+	--------------------------------
+	
+	If the chain has to be mounted upside down (the
+	connector at the other end, or the modules hanging
+	from a ceiling), pix.flipped() turns everything by
+	180 degrees when it is sent. Nothing else in the
+	sketch changes: text, icons and drawing still use
+	the normal coordinates.
+	
+	This cycles through the four modes every 2 seconds.
+	PIX_MIRROR_X also suits a sign seen through glass
+	from behind.
+*/
+
+#include "Pixie.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+uint8_t modes[] = {PIX_NORMAL, PIX_MIRROR_X, PIX_MIRROR_Y, PIX_ROTATE_180};
+
+void setup() {
+  pix.begin(); // Init display drivers
+  pix.write("Up here!");
+  pix.draw_line(40, 6, 59, 0);
+}
+
+void loop() {
+  for(uint8_t i = 0; i < 4; i++){
+    pix.set_orientation(modes[i]);
+    pix.show();
+    delay(2000);
+  }
+}
@@ -0,0 +1,47 @@
+/*
+	Pixie ATTRIBUTES Example
+	--------------------------------
+	
+	A clock with blinking colons, and a seconds field
+	that is underlined for a moment when it changes.
+	
+	The colons blink by themselves: they are given the
+	PIX_BLINK attribute once, and pix.update_blink()
+	blanks and shows them from millis(). The text is
+	only written when a digit changes, and
+	pix.show_changes() sends only when something did.
+*/
+
+#include "Pixie.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+
+uint32_t last_second = 0;
+
+void setup() {
+  pix.begin(); // Init display drivers
+  pix.set_attribute(6, PIX_BLINK); // The colons of "    12:34:56"
+  pix.set_attribute(9, PIX_BLINK);
+  pix.set_attribute(0, PIX_INVERT); // A lit block left of the time
+}
+
+void loop() {
+  uint32_t seconds = millis() / 1000;
+  if(seconds != last_second){
+    last_second = seconds;
+    char text[13];
+    sprintf(text, "    %02lu:%02lu:%02lu", (unsigned long)(seconds / 3600 % 24), (unsigned long)(seconds / 60 % 60), (unsigned long)(seconds % 60));
+    pix.write(text);
+    pix.mark_dirty(0, NUM_PIXIES * 10);
+    pix.set_attribute(10, PIX_UNDERLINE); // Highlight the seconds
+    pix.set_attribute(11, PIX_UNDERLINE);
+  }
+  if(millis() % 1000 > 250){
+    pix.set_attribute(10, 0);
+    pix.set_attribute(11, 0);
+  }
+  pix.update_blink(500);
+  pix.show_changes();
+}
@@ -0,0 +1,44 @@
+/*
+	Pixie CLOCK WIDGETS Example
+	--------------------------------
+	
+	An uptime clock (HH:MM:SS) and a counter on one
+	6-module chain, each redrawing only the digits that
+	changed. Once a second that is usually a single
+	position, so show_changes() encodes one module
+	instead of all six.
+	
+	The clock's digits flip over like a split-flap
+	clock when they change; the counter's roll up.
+*/
+
+#include "Pixie.h"
+#include "Pixie_Widgets.h"
+#define NUM_PIXIES  6                     // PCBs, not matrices
+#define CLK_PIN     4                     // Any digital pin
+#define DATA_PIN    5                     // Any digital pin
+Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieClock clock_field(pix, 0);           // Positions 0-7
+PixieCounter counter(pix, 8, 4, '0');     // Positions 8-11
+PixieTransition clock_flip(pix);
+PixieTransition counter_roll(pix);
+
+uint32_t count = 0;
+uint32_t last_count = 0;
+
+void setup() {
+  pix.begin(); // Init display drivers
+  clock_field.animate(clock_flip, PIX_FLIP, 150);
+  counter.animate(counter_roll, PIX_ROLL_UP, 100);
+}
+
+void loop() {
+  clock_field.set(millis() / 1000); // Does nothing until the second changes
+  if(millis() - last_count >= 250){
+    last_count += 250;
+    counter.set(count++ % 10000);
+  }
+  clock_field.update();
+  counter.update();
+  pix.show_changes();
+}
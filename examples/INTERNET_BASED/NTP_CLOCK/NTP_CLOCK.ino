@@ -37,6 +37,7 @@
 */
 
 #include "Pixie.h"
+#include "Pixie_Widgets.h"
 
 // 4-6 Pixies are supported, 5-6 is best and supports AM/PM display.
 #define NUM_PIXIES      6     // PCBs, not matrices
@@ -66,6 +67,7 @@
 #include <NTPClient.h>           // https://github.com/arduino-libraries/NTPClient  <--------------------------- EXTERNAL LIBRARY NEEDED
 
 Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN); // Set up display buffer
+PixieClock clock_field(pix, NUM_PIXIES == 6 ? 1 : 0); // HH:MM:SS, only changed digits are redrawn
 WiFiUDP ntp_UDP;
 NTPClient time_client(ntp_UDP, "pool.ntp.org", 3600, 60000);
 #define SECONDS_PER_HOUR 3600
@@ -178,44 +180,12 @@ void show_time() {
     hh = 12;
   }
 
-  char hh_ch[3] = {0, 0, 0};
-  itoa(hh, hh_ch, 10);
-  if (hh_ch[1] == 0) {
-    hh_ch[1] = hh_ch[0];
-    hh_ch[0] = '0';
-  }
-
-  char mm_ch[3] = {0, 0, 0};
-  itoa(mm, mm_ch, 10);
-  if (mm_ch[1] == 0) {
-    mm_ch[1] = mm_ch[0];
-    mm_ch[0] = '0';
-  }
-
-  char ss_ch[3] = {0, 0, 0};
-  itoa(ss, ss_ch, 10);
-  if (ss_ch[1] == 0) {
-    ss_ch[1] = ss_ch[0];
-    ss_ch[0] = '0';
-  }
-
+  clock_field.set(hh, mm, ss); // Usually just the last digit
   if (NUM_PIXIES == 6) {
-    char output[13];
-    sprintf(output, " %s:%s:%s %c", hh_ch, mm_ch, ss_ch, meridian);
-    pix.clear();
-    pix.write(output); // Update numerals
+    pix.write(meridian, 10);
   }
   else if (NUM_PIXIES == 5) {
-    char output[13];
-    sprintf(output, "%s:%s:%s %c", hh_ch, mm_ch, ss_ch, meridian);
-    pix.clear();
-    pix.write(output); // Update numerals
-  }
-  else if (NUM_PIXIES == 4) {
-    char output[13];
-    sprintf(output, "%s:%s:%s", hh_ch, mm_ch, ss_ch);
-    pix.clear();
-    pix.write(output); // Update numerals
+    pix.write(meridian, 9);
   }
 
   last_seconds = ss;
@@ -266,6 +236,7 @@ void init_wifi() {
 void init_ntp() {
   time_client.begin();
   time_client.setTimeOffset(UTC_OFFSET * SECONDS_PER_HOUR);
+  pix.clear(); // The clock field draws itself whole the first time
 }
 
 void init_displays() {
@@ -0,0 +1,267 @@
+// -------------------------------------------------------------------------------------------
+// USI Firmware of the PIXIE driver (ATTINY45), not a Pixie Library example!
+// VERSION 1.4.0 (USI)
+//
+// Changelog:
+//
+// V 1.0.0 - 1.3.0:
+//   See Pixie_Firmware_130
+//
+// V 1.4.0: (USI)
+//   Bits are received and forwarded by the USI in three-wire mode,
+//   clocked from the external CLK pin, instead of by polling CLK and
+//   DAT in software. The CPU only handles whole bytes, which raises
+//   the usable bitrate from ~67kHz to ~250kHz (USI_SPEED). Packets are
+//   the CRC-8 checked format of 1.3.0 (PRO_CRC in the library).
+//
+// !!! HARDWARE NOTE !!!
+//   The USI pins are fixed: DI = PB0, DO = PB1, USCK = PB2. Stock Pixie
+//   boards route CLK to PB1, DAT_IN to PB3, DAT_OUT to PB4 and I2C to
+//   PB0/PB2, so this firmware will NOT work on them. It needs boards
+//   wired as:
+//     CLK     -> PB2 (USCK)
+//     DAT_IN  -> PB0 (DI)
+//     DAT_OUT -> PB1 (DO)
+//     SDA     -> PB3
+//     SCL     -> PB4
+//
+// Hardware settings:
+// ATTINY45 @ 16MHz - millis()/micros() Enabled, BOD Disabled
+//
+// Required to compile:
+// https://github.com/SpenceKonde/ATTinyCore    - ATTINY45 Support for Arduino
+// https://github.com/felias-fogg/SoftI2CMaster - Bitbang 400kHz I2C using internal pullups
+// -------------------------------------------------------------------------------------------
+
+#include <avr/io.h>
+
+#define I2C_TIMEOUT 10000
+#define I2C_FASTMODE 1     // 400kHz
+#define I2C_PULLUP 1       // Enable pullups to avoid more passives on board
+#define I2C_NOINTERRUPT 1  // No interrupts allowed when sending I2C data
+#define SDA_PORT PORTB
+#define SCL_PORT PORTB
+#define SDA_PIN 3          // PB3
+#define SCL_PIN 4          // PB4
+
+#include <SoftI2CMaster.h> // Include I2C Library
+#define I2C_7BITADDR 0x63  // Each Pixie manages it's own display driver at a hard-coded I2C address
+
+#define PACKET_BYTES 13
+
+// Idle loop iterations (~6 cycles each) with no completed byte before the packet
+// is considered final. 1500 * 6 / 16MHz = ~0.56ms, matching the 1.2.0+ timeout.
+#define END_OF_PACKET_LOOPS 1500
+
+uint8_t disp[PACKET_BYTES]; // Display buffer, also the 13-byte delay line
+uint8_t disp_index = 0;     // Index in disp[]
+bool updated = false;       // Have new bytes been received?
+
+void(* reset_func) (void) = 0x00; // Declare reset function @ address 0
+
+const uint8_t DAT_IN_pin  = 0; // PB0 (DI)
+const uint8_t DAT_OUT_pin = 1; // PB1 (DO)
+const uint8_t CLK_pin     = 2; // PB2 (USCK)
+
+// These values are defaulted to the ideals for a non-Pro display.
+// Marking your displays as PRO_CRC in the Pixie() library constructor will change these values to 10mA and led_flip = true, to suit the different hardware of the Pixie Pro.
+uint8_t row_current = B00001110; // 35mA default
+bool led_flip = false;
+uint8_t pixie_brightness = 127;
+
+// Command definitions
+#define COMMAND_WRITE       0
+#define COMMAND_LED_FLIP    1
+#define COMMAND_ROW_CURRENT 2
+#define COMMAND_RESET       3
+
+void setup() {
+  delay(10);
+  pinMode(CLK_pin,     INPUT);
+  pinMode(DAT_IN_pin,  INPUT);
+  pinMode(DAT_OUT_pin, OUTPUT);
+
+  i2c_init();       // Init bitbang I2C
+  init_display();   // Init display driver
+  for (uint8_t i = 0; i < PACKET_BYTES; i++) {
+    disp[i] = 0;
+  }
+  update_display(); // Blank display
+
+  // Three-wire mode, external clock, data sampled on the falling CLK edge.
+  // DO then changes on the rising edge, exactly like the polled firmware,
+  // so USI and non-USI Pixies see the same waveform from the library.
+  USICR = (1 << USIWM0) | (1 << USICS1) | (1 << USICS0);
+  start_packet();
+}
+
+// Resets byte framing and preloads the first byte to forward
+void start_packet() {
+  disp_index = 0;
+  USIDR = disp[0];
+  USISR = (1 << USIOIF); // Clear overflow flag, 4-bit counter = 0
+}
+
+void loop() {
+  uint16_t idle = 0;
+
+  // Wait for the USI to finish a byte (16 CLK edges)
+  while (!(USISR & (1 << USIOIF))) {
+    if (++idle >= END_OF_PACKET_LOOPS) {
+      if (PINB & (1 << CLK_pin)) { // CLK stuck HIGH: reset request
+        while (PINB & (1 << CLK_pin));
+        reset_func();
+      }
+      if (updated) { // End Of Packet (timeout)
+        updated = false;
+        update_display(); // Send display buffer to matrix driver
+      }
+      start_packet();
+      return;
+    }
+  }
+
+  // A byte is complete and CLK is LOW. The next byte to forward must be
+  // in USIDR before CLK rises again, this is the only time-critical part.
+  uint8_t in = USIBR;
+  uint8_t next = disp_index + 1;
+  if (next >= PACKET_BYTES) {
+    next = 0;
+  }
+  USIDR = disp[next];
+  USISR = (1 << USIOIF);
+
+  disp[disp_index] = in;
+  disp_index = next;
+  updated = true;
+}
+
+void init_display() {
+  i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+  i2c_write(0xFF);                  // write to reset register
+  i2c_write(0x00);                  // write row data - sets dual display mode
+  i2c_stop();
+
+  i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+  i2c_write(0x00);                  // write to configuration register
+  i2c_write(0x19);                  // write row data - sets dual display mode
+  i2c_stop();
+
+  i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+  i2c_write(0x0D);                  // write to LIGHTING EFFECT REGISTER
+  i2c_write(row_current);           // sets row current
+  i2c_stop();
+
+  i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+  i2c_write(0x19);                  // write to PWM REGISTER
+  i2c_write(pixie_brightness);      // sets pwm
+  i2c_stop();
+}
+
+// CRC-8 (poly 0x2F, init 0xFF, xorout 0xFF) over the 7 data bits of all 13 bytes,
+// same as firmware 1.3.0. The CRC travels MSB-first in bit 7 of bytes 0-7, bytes 8-12 have bit 7 = 0.
+bool check_crc() {
+  uint8_t crc = 0xFF;
+  uint8_t sent = 0;
+  for (uint8_t i = 0; i < PACKET_BYTES; i++) {
+    if (i < 8) {
+      bitWrite(sent, 7 - i, bitRead(disp[i], 7));
+    }
+    else if (bitRead(disp[i], 7)) {
+      return false;
+    }
+    crc ^= disp[i] & 0x7F;
+    for (uint8_t b = 0; b < 8; b++) {
+      if (crc & 0x80) {
+        crc = (crc << 1) ^ 0x2F;
+      }
+      else {
+        crc <<= 1;
+      }
+    }
+  }
+  return (crc ^ 0xFF) == sent;
+}
+
+void update_display() {
+  if (check_crc() == true) { // If no glitches detected
+
+    uint8_t command = disp[0] & 0x7F;
+    uint8_t data    = disp[1] & 0x7F;
+    pixie_brightness = disp[2] & 0x7F;
+
+    if (command == COMMAND_WRITE) {
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+      i2c_write(0x00);                  // write to configuration register
+      i2c_write(0x19);                  // write row data - sets dual display mode
+      i2c_stop();
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+      i2c_write(0x19);                  // write to PWM REGISTER
+      i2c_write(pixie_brightness);      // sets pwm
+      i2c_stop();
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c
+      if(led_flip){
+        i2c_write(0x01);                 // write to DIGIT 1
+      }
+      else{
+        i2c_write(0x0E);                 // write to DIGIT 1
+      }
+
+      // PICTURE DATA HERE IN COLUMN FORMAT (rotated 90deg clockwise)
+      for (uint8_t i = 0; i < 5; i++) {
+        i2c_write(disp[3 + i] & 0x7F);
+      }
+      // ----------------------------------
+
+      i2c_stop();
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+      i2c_write(0x0c);                 // write to update display register
+      i2c_write(0xFF);                 // write row data
+      i2c_stop();
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c
+      if(led_flip){
+        i2c_write(0x0E);                 // write to DIGIT 1
+      }
+      else{
+        i2c_write(0x01);                 // write to DIGIT 1
+      }
+
+      // PICTURE DATA HERE IN ROW FORMAT
+      for (uint8_t r = 0; r < 7; r++) {
+        uint8_t row = 0;
+        for (uint8_t c = 0; c < 5; c++) {
+          bitWrite(row, c, bitRead(disp[8 + c], r));
+        }
+        i2c_write(row); // mirrored on x-axis, right side up
+      }
+      // -------------------------------
+
+      i2c_stop();
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+      i2c_write(0x0c);                 // write to update display register
+      i2c_write(0xFF);                 // write row data
+      i2c_stop();
+    }
+    else if (command == COMMAND_ROW_CURRENT) {
+      if (data == 8 || data == 9 || data == 14 || data == 0 || data == 1) { // 5, 10, 35, 40, 45mA
+        row_current = data;
+      }
+
+      i2c_start_wait((I2C_7BITADDR << 1) | I2C_WRITE); //  write i2c address 0x63
+      i2c_write(0x0D);                  // write to LIGHTING EFFECT REGISTER
+      i2c_write(row_current);           // sets row current
+      i2c_stop();
+    }
+    else if (command == COMMAND_LED_FLIP) {
+      led_flip = data;
+    }
+    else if (command == COMMAND_RESET) {
+      reset_func();
+    }
+  }
+}
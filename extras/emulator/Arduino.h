@@ -0,0 +1,103 @@
+/*!
+ * @file Arduino.h
+ *
+ * Minimal host stand-in for the Arduino core, just enough to build the
+ * unmodified Pixie library on Linux. Pin writes are routed to an emulated
+ * Pixie chain and all delays advance a simulated clock instead of sleeping.
+ *
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef arduino_host_h
+#define arduino_host_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P memcpy
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t val);
+int      digitalRead(uint8_t pin);
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+uint32_t millis();
+uint32_t micros();
+void     yield();
+
+char* itoa(int value, char* str, int base);
+char* utoa(unsigned int value, char* str, int base);
+char* ltoa(long value, char* str, int base);
+char* ultoa(unsigned long value, char* str, int base);
+
+// Print, as in the Arduino core: derived classes only implement write(uint8_t)
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+class Print{
+  public:
+	virtual ~Print(){}
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	size_t write(const char* str){ return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+
+	size_t print(const __FlashStringHelper* ifsh);
+	size_t print(const char* str){ return write(str); }
+	size_t print(char c){ return write((uint8_t)c); }
+	size_t print(unsigned char n, int base = DEC){ return print((unsigned long)n, base); }
+	size_t print(int n, int base = DEC){ return print((long)n, base); }
+	size_t print(unsigned int n, int base = DEC){ return print((unsigned long)n, base); }
+	size_t print(long n, int base = DEC);
+	size_t print(unsigned long n, int base = DEC);
+	size_t print(double n, int digits = 2);
+
+	template <typename T> size_t println(T value){ size_t n = print(value); return n + println(); }
+	size_t println(){ return write((const uint8_t*)"\r\n", 2); }
+
+  private:
+	size_t print_number(unsigned long n, uint8_t base);
+};
+
+class HostSerial{
+  public:
+	void begin(uint32_t baud){ (void)baud; }
+	void print(const char* s){ fputs(s, stdout); }
+	void print(int n){ printf("%d", n); }
+	void println(const char* s = ""){ puts(s); }
+	void println(int n){ printf("%d\n", n); }
+};
+extern HostSerial Serial;
+
+// Host side of the fake pin layer --------------------------------------------
+class PixieChain;
+
+void     host_attach(PixieChain* chain, uint8_t clk_pin, uint8_t dat_pin);
+void     host_set_pin_cost(uint32_t ns); // Simulated cost of one digitalWrite()
+uint64_t host_time_ns();
+uint32_t host_pin_writes();
+
+#endif
@@ -0,0 +1,190 @@
+/*!
+ * @file Arduino_Host.cpp
+ *
+ * Fake pin layer and simulated clock behind the host Arduino.h.
+ *
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Arduino.h"
+#include "Pixie_Emulator.h"
+
+HostSerial Serial;
+
+// Print, following the Arduino core ---------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size){
+	size_t n = 0;
+	while(size--){
+		n += write(*buffer++);
+	}
+	return n;
+}
+
+size_t Print::print(const __FlashStringHelper* ifsh){
+	const char* p = (const char*)ifsh;
+	size_t n = 0;
+	while(uint8_t c = pgm_read_byte(p++)){ // One byte at a time, like PROGMEM on AVR
+		n += write(c);
+	}
+	return n;
+}
+
+size_t Print::print(long n, int base){
+	if(base == DEC && n < 0){
+		return write((uint8_t)'-') + print_number(0UL - (unsigned long)n, DEC);
+	}
+	return print_number(n, base);
+}
+
+size_t Print::print(unsigned long n, int base){
+	return print_number(n, base);
+}
+
+size_t Print::print_number(unsigned long n, uint8_t base){
+	char buf[8 * sizeof(long) + 1];
+	char* str = &buf[sizeof(buf) - 1];
+	*str = 0;
+	if(base < 2){
+		base = 10;
+	}
+	do{
+		char c = n % base;
+		n /= base;
+		*--str = c < 10 ? c + '0' : c + 'A' - 10;
+	}while(n);
+	return write(str);
+}
+
+size_t Print::print(double number, int digits){
+	if(isnan(number)) return print("nan");
+	if(isinf(number)) return print("inf");
+	if(number > 4294967040.0 || number < -4294967040.0) return print("ovf");
+	size_t n = 0;
+	if(number < 0.0){
+		n += print('-');
+		number = -number;
+	}
+	double rounding = 0.5;
+	for(int i = 0; i < digits; i++){
+		rounding /= 10.0;
+	}
+	number += rounding;
+	unsigned long whole = (unsigned long)number;
+	double remainder = number - (double)whole;
+	n += print(whole);
+	if(digits > 0){
+		n += print('.');
+	}
+	while(digits-- > 0){
+		remainder *= 10.0;
+		unsigned int digit = (unsigned int)remainder;
+		n += print(digit);
+		remainder -= digit;
+	}
+	return n;
+}
+
+static PixieChain* host_chain = NULL;
+static uint8_t  host_clk_pin  = 0xFF;
+static uint8_t  host_dat_pin  = 0xFF;
+static uint64_t host_now_ns   = 0;
+static uint32_t host_pin_ns   = 0;
+static uint32_t host_writes   = 0;
+
+void host_attach(PixieChain* chain, uint8_t clk_pin, uint8_t dat_pin){
+	host_chain   = chain;
+	host_clk_pin = clk_pin;
+	host_dat_pin = dat_pin;
+	host_writes  = 0;
+}
+
+void host_set_pin_cost(uint32_t ns){
+	host_pin_ns = ns;
+}
+
+uint64_t host_time_ns(){
+	return host_now_ns;
+}
+
+uint32_t host_pin_writes(){
+	return host_writes;
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+	(void)pin;
+	(void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+	host_now_ns += host_pin_ns;
+	host_writes++;
+	if(host_chain == NULL){
+		return;
+	}
+	if(pin == host_clk_pin){
+		host_chain->set_clk(val, host_now_ns);
+	}
+	else if(pin == host_dat_pin){
+		host_chain->set_dat(val, host_now_ns);
+	}
+}
+
+int digitalRead(uint8_t pin){
+	(void)pin;
+	return LOW;
+}
+
+void delayMicroseconds(uint32_t us){
+	host_now_ns += (uint64_t)us*1000;
+	if(host_chain != NULL){
+		host_chain->advance(host_now_ns);
+	}
+}
+
+void delay(uint32_t ms){
+	delayMicroseconds(ms*1000);
+}
+
+uint32_t millis(){
+	return host_now_ns / 1000000;
+}
+
+uint32_t micros(){
+	return host_now_ns / 1000;
+}
+
+void yield(){
+}
+
+char* ultoa(unsigned long value, char* str, int base){
+	char tmp[33];
+	uint8_t len = 0;
+	do{
+		uint8_t digit = value % base;
+		tmp[len++] = digit < 10 ? '0'+digit : 'a'+digit-10;
+		value /= base;
+	} while(value);
+	for(uint8_t i = 0; i < len; i++){
+		str[i] = tmp[len-1-i];
+	}
+	str[len] = 0;
+	return str;
+}
+
+char* ltoa(long value, char* str, int base){
+	if(value < 0 && base == 10){
+		str[0] = '-';
+		ultoa(-(unsigned long)value, str+1, base);
+		return str;
+	}
+	return ultoa(value, str, base);
+}
+
+char* utoa(unsigned int value, char* str, int base){
+	return ultoa(value, str, base);
+}
+
+char* itoa(int value, char* str, int base){
+	return ltoa(value, str, base);
+}
@@ -0,0 +1,429 @@
+/*!
+ * @file Pixie_Emulator.cpp
+ *
+ * Host-side model of a chain of Pixie modules running the stock ATTINY45
+ * firmware. See Pixie_Emulator.h and README.md.
+ *
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Emulator.h"
+#include <stdio.h>
+#include <string.h>
+
+#define COMMAND_WRITE       0
+#define COMMAND_LED_FLIP    1
+#define COMMAND_ROW_CURRENT 2
+#define COMMAND_RESET       3
+
+/**************************************************************************/
+/*!
+    @brief	Creates a module running firmware **fw** (PIX_FW_100/110/120/130/140)
+
+	Timing constants follow the firmware sources: the 1.1.0 asm loop times
+	out after 4096 iterations (~2.3ms), 1.2.0+ after 1024 (~0.575ms), and
+	1.0.0 uses millis() with a 3ms packet gap and a 10ms reset hold.
+	The 1.4.0 USI shifts bits in hardware, but needs ~20 cycles after each
+	byte to move the next delayed byte into USIDR before CLK rises again.
+	latch_us is an estimate of the bit-banged 400kHz I2C update.
+*/
+/**************************************************************************/
+PixieModule::PixieModule(uint16_t fw){
+	firmware = fw;
+	if(firmware == PIX_FW_100){
+		packet_bits = 128;
+		timeout_us  = 3000;
+		reset_us    = 10000;
+		latch_us    = 2000;
+		boot_us     = 1000;
+		min_half_ns = 10000;
+	}
+	else if(firmware == PIX_FW_110){
+		packet_bits = 128;
+		timeout_us  = 2300;
+		reset_us    = 2300;
+		latch_us    = 1500;
+		boot_us     = 10000;
+		min_half_ns = 5000;
+	}
+	else{
+		packet_bits = 104;
+		timeout_us  = 575;
+		reset_us    = 575;
+		latch_us    = 1000;
+		boot_us     = 10000;
+		min_half_ns = 5000;
+	}
+	byte_gap_ns = 0;
+	if(firmware == PIX_FW_140){
+		min_half_ns = 250;  // USI clock input synchronizer
+		byte_gap_ns = 1500;
+	}
+	frames = check_errors = commands = resets = missed_edges = 0;
+	busy_until_ns = 0;
+	skip_pulse = false;
+	power_on();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Mirrors setup(): zeroed buffer, blank driver, default settings
+*/
+/**************************************************************************/
+void PixieModule::power_on(){
+	memset(disp, 0, sizeof(disp));
+	memset(image, 0, sizeof(image));
+	disp_index = 0;
+	out_bit = false;
+	updated = false;
+	pwm = 127;
+	led_flip = false;
+	if(firmware >= PIX_FW_120){
+		row_current = 14; // 35mA
+	}
+	else{
+		row_current = 0;  // 40mA
+	}
+}
+
+uint8_t PixieModule::read_byte(uint8_t index){
+	uint8_t out = 0;
+	for(uint8_t b = 0; b < 8; b++){
+		out = (out << 1) | disp[index*8+b];
+	}
+	return out;
+}
+
+bool PixieModule::check_parity(){ // Even parity, as in firmware 1.2.0
+	for(uint8_t i = 0; i < 13; i++){
+		uint8_t data = read_byte(i);
+		uint8_t odd_ones = 0;
+		for(uint8_t b = 0; b < 7; b++){
+			odd_ones += (data >> b) & 1;
+		}
+		if((odd_ones & 1) == (data >> 7)){
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PixieModule::check_crc(){ // CRC-8 0x2F in bit 7 of bytes 0-7, as in firmware 1.3.0
+	uint8_t crc = 0xFF;
+	for(uint8_t i = 0; i < 104; i++){
+		bool data_bit = ((i & 7) == 0) ? 0 : disp[i];
+		bool feedback = ((crc >> 7) & 1) ^ data_bit;
+		crc <<= 1;
+		if(feedback){
+			crc ^= 0x2F;
+		}
+	}
+	crc ^= 0xFF;
+	for(uint8_t i = 0; i < 13; i++){
+		bool expected = (i < 8) ? ((crc >> (7-i)) & 1) : 0;
+		if(disp[i*8] != expected){
+			return false;
+		}
+	}
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	End of packet: decodes the buffer like update_display() does
+
+    @param	t_ns	Time the timeout fired
+*/
+/**************************************************************************/
+void PixieModule::latch(uint64_t t_ns){
+	disp_index = 0;
+	if(!updated){
+		return;
+	}
+	updated = false;
+	busy_until_ns = t_ns + (uint64_t)latch_us*1000;
+
+	if(firmware < PIX_FW_120){
+		if(disp[8] == 1){ // PWM BIT in PWM COLUMN
+			pwm = read_byte(1) & 0x7F;
+		}
+		for(uint8_t i = 0; i < 5; i++){
+			uint8_t left  = read_byte(3+i);
+			uint8_t right = read_byte(11+i);
+			image[i]   = (left  >= 128) ? 0 : left;
+			image[5+i] = (right >= 128) ? 0 : right;
+		}
+		frames++;
+		return;
+	}
+
+	bool valid;
+	if(firmware >= PIX_FW_130){
+		valid = check_crc();
+	}
+	else{
+		valid = check_parity();
+	}
+	if(!valid){
+		check_errors++;
+		return;
+	}
+
+	uint8_t command = read_byte(0) & 0x7F;
+	uint8_t data    = read_byte(1) & 0x7F;
+	pwm             = read_byte(2) & 0x7F;
+
+	if(command == COMMAND_WRITE){
+		for(uint8_t i = 0; i < 10; i++){
+			image[i] = read_byte(3+i) & 0x7F;
+		}
+		frames++;
+	}
+	else if(command == COMMAND_ROW_CURRENT){
+		if(data == 8 || data == 9 || data == 14 || data == 0 || data == 1){
+			row_current = data;
+		}
+		commands++;
+	}
+	else if(command == COMMAND_LED_FLIP){
+		led_flip = data;
+		commands++;
+	}
+	else if(command == COMMAND_RESET){
+		commands++;
+		resets++;
+		power_on();
+		busy_until_ns = t_ns + (uint64_t)boot_us*1000;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Creates **count** modules running firmware **fw**
+*/
+/**************************************************************************/
+PixieChain::PixieChain(uint8_t count, uint16_t fw){
+	for(uint8_t i = 0; i < count; i++){
+		modules.push_back(PixieModule(fw));
+	}
+	clk = false;
+	dat = false;
+	bits = 0;
+	last_rise_ns = 0;
+	last_fall_ns = 0;
+	inject_faults(0, false);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Corrupts every packet on its way into modules[0]
+
+    @param	flips	Number of distinct bits to invert per packet (0-8)
+    @param	slip	Also drop one CLK pulse per packet, shifting the rest
+    @param	seed	Seed for the fault positions
+*/
+/**************************************************************************/
+void PixieChain::inject_faults(uint8_t flips, bool slip, uint32_t seed){
+	fault_flips = flips;
+	fault_slip  = slip;
+	fault_rng   = seed ? seed : 1;
+	fault_bit   = 0;
+}
+
+uint32_t PixieChain::random(){ // xorshift32
+	fault_rng ^= fault_rng << 13;
+	fault_rng ^= fault_rng >> 17;
+	fault_rng ^= fault_rng << 5;
+	return fault_rng;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fires any end-of-packet timeouts that have expired by **t_ns**
+*/
+/**************************************************************************/
+void PixieChain::advance(uint64_t t_ns){
+	if(clk){
+		return; // Timeouts only run while waiting for CLK to rise
+	}
+	for(uint8_t i = 0; i < modules.size(); i++){
+		PixieModule& m = modules[i];
+		uint64_t ref = last_fall_ns;
+		if(m.busy_until_ns > ref){
+			ref = m.busy_until_ns;
+		}
+		uint64_t fire = ref + (uint64_t)m.timeout_us*1000;
+		if(t_ns < fire){
+			continue;
+		}
+		if(m.firmware == PIX_FW_100){
+			if(m.updated){
+				m.latch(fire);
+			}
+		}
+		else if(m.updated || m.disp_index != 0){
+			m.latch(fire);
+		}
+		if(i == 0){
+			fault_bit = 0;
+		}
+	}
+}
+
+void PixieChain::set_dat(bool level, uint64_t t_ns){
+	advance(t_ns);
+	dat = level;
+}
+
+void PixieChain::set_clk(bool level, uint64_t t_ns){
+	advance(t_ns);
+	if(level == clk){
+		return;
+	}
+	clk = level;
+
+	if(clk){ // CLK ROSE HIGH
+		bits++;
+		for(uint8_t i = 0; i < modules.size(); i++){
+			PixieModule& m = modules[i];
+			m.skip_pulse = (t_ns < m.busy_until_ns) || (bits > 1 && t_ns - last_fall_ns < m.min_half_ns);
+			if(m.byte_gap_ns && m.updated && (m.disp_index & 7) == 0 && t_ns - last_fall_ns < m.byte_gap_ns){
+				m.skip_pulse = true; // USIDR not reloaded in time
+			}
+			if(m.skip_pulse){
+				m.missed_edges++;
+			}
+			else{
+				m.out_bit = m.disp[m.disp_index];
+			}
+		}
+		last_rise_ns = t_ns;
+		return;
+	}
+
+	// CLK FELL LOW
+	uint64_t high_ns = t_ns - last_rise_ns;
+	bool in = dat;
+	for(uint8_t i = 0; i < modules.size(); i++){
+		PixieModule& m = modules[i];
+		bool upstream = in;
+		in = m.out_bit; // What the next module samples on this edge
+		if(m.skip_pulse){
+			continue;
+		}
+		if(high_ns >= (uint64_t)m.reset_us*1000){
+			m.resets++;
+			m.power_on();
+			m.busy_until_ns = t_ns + (uint64_t)m.boot_us*1000;
+			in = m.out_bit;
+			continue;
+		}
+		if(high_ns < m.min_half_ns){
+			m.missed_edges++;
+			continue;
+		}
+		if(i == 0 && (fault_flips != 0 || fault_slip)){
+			if(fault_bit == 0){
+				for(uint8_t f = 0; f < fault_flips; f++){
+					bool unique;
+					do{
+						fault_pos[f] = random() % m.packet_bits;
+						unique = true;
+						for(uint8_t g = 0; g < f; g++){
+							unique = unique && fault_pos[g] != fault_pos[f];
+						}
+					} while(!unique);
+				}
+				fault_slip_pos = random() % m.packet_bits;
+			}
+			uint16_t bit = fault_bit++;
+			if(fault_slip && bit == fault_slip_pos){
+				continue; // Pulse lost, everything after it lands one bit early
+			}
+			for(uint8_t f = 0; f < fault_flips; f++){
+				if(fault_pos[f] == bit){
+					upstream = !upstream;
+				}
+			}
+		}
+		m.disp[m.disp_index] = upstream;
+		m.disp_index++;
+		if(m.firmware != PIX_FW_100){
+			m.updated = true;
+		}
+		if(m.disp_index >= m.packet_bits){
+			m.disp_index = 0;
+			if(m.firmware == PIX_FW_100){
+				m.updated = true;
+			}
+		}
+	}
+	last_fall_ns = t_ns;
+}
+
+uint8_t PixieChain::count(){
+	return modules.size();
+}
+
+PixieModule& PixieChain::module(uint8_t index){
+	return modules[index];
+}
+
+/**************************************************************************/
+/*!
+    @brief	Module holding display positions 2*pos_pair and 2*pos_pair+1
+
+	The first bytes shifted out travel furthest, so the library's display
+	position 0 lives on the module at the far end of the chain.
+*/
+/**************************************************************************/
+PixieModule& PixieChain::module_at_position(uint8_t pos){
+	return modules[modules.size()-1-(pos >> 1)];
+}
+
+void PixieChain::get_columns(uint8_t* out){
+	for(uint8_t p = 0; p < modules.size(); p++){
+		memcpy(out+p*10, modules[modules.size()-1-p].image, 10);
+	}
+}
+
+void PixieChain::print_image(){
+	uint16_t cols = modules.size()*10;
+	uint8_t buf[2560];
+	get_columns(buf);
+	for(uint8_t y = 0; y < 7; y++){
+		for(uint16_t x = 0; x < cols; x++){
+			if(x != 0 && x % 5 == 0){
+				printf(x % 10 == 0 ? " | " : " ");
+			}
+			putchar(((buf[x] >> y) & 1) ? '#' : '.');
+		}
+		putchar('\n');
+	}
+}
+
+uint32_t PixieChain::frames(){
+	uint32_t lowest = 0xFFFFFFFF;
+	for(uint8_t i = 0; i < modules.size(); i++){
+		if(modules[i].frames < lowest){
+			lowest = modules[i].frames;
+		}
+	}
+	return lowest;
+}
+
+uint32_t PixieChain::errors(){
+	uint32_t total = 0;
+	for(uint8_t i = 0; i < modules.size(); i++){
+		total += modules[i].check_errors + modules[i].missed_edges;
+	}
+	return total;
+}
+
+void PixieChain::print_stats(){
+	for(uint8_t i = 0; i < modules.size(); i++){
+		PixieModule& m = modules[i];
+		printf("  module %2u: fw %u  frames %6u  commands %3u  check_err %4u  missed %5u  resets %2u  pwm %3u  current %2u  flip %u\n",
+			i, m.firmware, m.frames, m.commands, m.check_errors, m.missed_edges, m.resets, m.pwm, m.row_current, m.led_flip);
+	}
+}
@@ -0,0 +1,116 @@
+/*!
+ * @file Pixie_Emulator.h
+ *
+ * Host-side model of a chain of Pixie modules running the stock ATTINY45
+ * firmware (examples/PIXIE_FIRMWARE). Only the protocol behavior is modeled:
+ * the bit shift-through, end-of-packet timeout, reset, header decoding,
+ * parity/CRC check, command handling and the resulting 5x7 images.
+ *
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_emulator_h
+#define pixie_emulator_h
+
+#include <stdint.h>
+#include <vector>
+
+#define PIX_FW_100 100 // 128-bit packets, polled input loop
+#define PIX_FW_110 110 // 128-bit packets, inline-asm input loop
+#define PIX_FW_120 120 // 104-bit PRO packets, parity + command set
+#define PIX_FW_130 130 // 104-bit PRO packets, CRC-8 + command set
+#define PIX_FW_140 140 // 1.3.0 packets received by the USI (re-routed boards)
+
+/**************************************************************************/
+/*!
+    @brief	One Pixie PCB (two 5x7 matrices) and the state of its firmware
+*/
+/**************************************************************************/
+class PixieModule{
+  public:
+	PixieModule(uint16_t fw = PIX_FW_120);
+	void power_on();
+
+	uint16_t firmware;
+	uint8_t  packet_bits;     // 128 (1.0.0/1.1.0) or 104 (1.2.0+)
+	uint32_t timeout_us;      // end of packet timeout / CLK-high reset threshold
+	uint32_t reset_us;        // CLK high this long resets the module
+	uint32_t latch_us;        // time spent updating the matrix driver after a latch
+	uint32_t boot_us;         // time spent in setup() after a reset
+	uint32_t min_half_ns;     // fastest CLK half-period the input loop can follow
+	uint32_t byte_gap_ns;     // USI only: LOW time needed after a byte to reload USIDR
+
+	uint8_t  disp[128];       // bool disp[] of the firmware
+	uint8_t  disp_index;
+	bool     out_bit;         // DAT_OUT level
+	bool     updated;
+
+	uint8_t  image[10];       // Left matrix columns 0-4, right matrix columns 0-4
+	uint8_t  pwm;             // 7-bit brightness
+	uint8_t  row_current;
+	bool     led_flip;
+
+	uint64_t busy_until_ns;   // Edges before this are not seen (I2C update / boot)
+	bool     skip_pulse;      // Current CLK pulse was missed
+
+	uint32_t frames;          // Packets latched and shown
+	uint32_t check_errors;    // Packets rejected by check_parity() / check_crc()
+	uint32_t commands;        // Non-WRITE commands executed
+	uint32_t resets;
+	uint32_t missed_edges;    // CLK pulses lost to busy time or too-fast clocking
+
+	void latch(uint64_t t_ns);
+
+  private:
+	uint8_t read_byte(uint8_t index);
+	bool check_parity();
+	bool check_crc();
+};
+
+/**************************************************************************/
+/*!
+    @brief	A chain of PixieModules sharing CLK, with DAT passed through each
+
+	modules[0] is wired to the controller. The library's display_buffer
+	starts with the module at the far end of the chain (display position 0).
+*/
+/**************************************************************************/
+class PixieChain{
+  public:
+	PixieChain(uint8_t count, uint16_t fw = PIX_FW_120);
+
+	void set_clk(bool level, uint64_t t_ns);
+	void set_dat(bool level, uint64_t t_ns);
+	void advance(uint64_t t_ns);
+
+	uint8_t count();
+	PixieModule& module(uint8_t index);
+	PixieModule& module_at_position(uint8_t pos);
+	void get_columns(uint8_t* out);  // 10 columns per module, display position order
+	void print_image();
+	void print_stats();
+
+	uint64_t bits;          // CLK pulses sent by the controller
+	uint32_t frames();      // Packets latched by every module in the chain
+	uint32_t errors();      // Sum of rejected packets and missed edges
+
+	void inject_faults(uint8_t flips, bool slip, uint32_t seed = 1);
+
+  private:
+	std::vector<PixieModule> modules;
+	bool clk;
+	bool dat;
+	uint64_t last_rise_ns;
+	uint64_t last_fall_ns;
+
+	// Fault injection on the wire into modules[0]
+	uint32_t random();
+	uint8_t  fault_flips;
+	bool     fault_slip;
+	uint32_t fault_rng;
+	uint16_t fault_bit;       // Bits sampled by modules[0] in the current packet
+	uint8_t  fault_pos[8];    // Packet bit positions to corrupt
+	uint8_t  fault_slip_pos;  // Packet bit position whose CLK pulse is lost
+};
+
+#endif
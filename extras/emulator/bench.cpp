@@ -0,0 +1,2467 @@
+/*!
+ * @file bench.cpp
+ *
+ * Runs the unmodified Pixie library against emulated Pixie chains.
+ * Checks that what the modules end up showing matches what was drawn,
+ * then reports frame rates, bit counts and simulated wall time.
+ *
+ * Usage: ./pixie_bench [--pin-ns N] [--verbose]
+ *
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Arduino.h"
+#include "Pixie_Emulator.h"
+#include "Pixie.h"
+#include "Pixie_Scroller.h"
+#include "Pixie_Print.h"
+#include "Pixie_Fixed.h"
+#include "Pixie_Text.h"
+#include "Pixie_Fader.h"
+#include "Pixie_Gray.h"
+#include "Pixie_Player.h"
+#include "Pixie_Layers.h"
+#include "Pixie_Transition.h"
+#include "Pixie_Widgets.h"
+#include "Pixie_Icon_Pack.h"
+#include "Pixie_Icon_Pack_P.h"
+#include "font_7bit.h"
+#include "font_ext.h"
+#include <chrono>
+
+#define CLK_PIN  4
+#define DATA_PIN 5
+
+static uint16_t failures = 0;
+static bool     verbose  = false;
+
+static void result(const char* name, bool pass, PixieChain& chain){
+	printf("%s  %s\n", pass ? "PASS" : "FAIL", name);
+	if(!pass){
+		failures++;
+	}
+	if(!pass || verbose){
+		chain.print_image();
+		chain.print_stats();
+	}
+}
+
+// Compares display position **pos** against a 5-column glyph from font.h
+static bool expect_char(PixieChain& chain, uint8_t pos, char chr){
+	uint8_t cols[2560];
+	chain.get_columns(cols);
+	if(chr >= 32){
+		chr -= 32;
+	}
+	for(uint8_t i = 0; i < 5; i++){
+		if(cols[pos*5+i] != (pgm_read_byte(col+(chr*5+i)) & 0x7F)){
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool expect_text(PixieChain& chain, const char* text, uint8_t pos){
+	for(uint8_t i = 0; text[i] != 0; i++){
+		if(!expect_char(chain, pos+i, text[i])){
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool expect_blank(PixieChain& chain, uint8_t from, uint8_t to){
+	for(uint8_t p = from; p < to; p++){
+		if(!expect_char(chain, p, ' ')){
+			return false;
+		}
+	}
+	return true;
+}
+
+static void settle(PixieChain& chain){
+	delay(20); // Let every module time out and latch
+	chain.advance(host_time_ns());
+}
+
+// -----------------------------------------------------------------------------
+
+static void check_legacy(uint16_t fw, uint8_t speed, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, LEGACY);
+	pix.begin(speed);
+
+	pix.clear();
+	pix.write('W', 2);
+	pix.show();
+	settle(chain);
+	bool pass = expect_char(chain, 2, 'W') && expect_blank(chain, 0, 2) && expect_blank(chain, 3, 6);
+
+	pix.print((char*)"Pr");
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "WPr", 2) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+static void check_pro(uint16_t fw, uint8_t type, uint8_t speed, const char* name){
+	char label[96];
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(speed);
+
+	bool pass = true;
+	for(uint8_t i = 0; i < chain.count(); i++){
+		pass = pass && chain.module(i).led_flip && chain.module(i).row_current == mA_10;
+	}
+	snprintf(label, sizeof(label), "%s: begin() sends LED_FLIP and ROW_CURRENT", name);
+	result(label, pass, chain);
+
+	pix.clear();
+	pix.write((char*)"Pixie!", 0);
+	pix.show();
+	settle(chain);
+	snprintf(label, sizeof(label), "%s: write(char*)", name);
+	result(label, expect_text(chain, "Pixie!", 0) && chain.errors() == 0, chain);
+
+	pix.brightness(64);
+	settle(chain);
+	pass = true;
+	for(uint8_t i = 0; i < chain.count(); i++){
+		pass = pass && chain.module(i).pwm == 64;
+	}
+	snprintf(label, sizeof(label), "%s: brightness()", name);
+	result(label, pass && expect_text(chain, "Pixie!", 0), chain);
+
+	uint32_t resets = chain.module(0).resets;
+	pix.command(PIX_RESET);
+	settle(chain);
+	pass = expect_blank(chain, 0, 6);
+	for(uint8_t i = 0; i < chain.count(); i++){
+		pass = pass && !chain.module(i).led_flip && chain.module(i).resets == resets+1;
+	}
+	snprintf(label, sizeof(label), "%s: PIX_RESET command", name);
+	result(label, pass, chain);
+}
+
+// Drawing calls share one column framebuffer, so both wire layouts must agree
+static void check_drawing(uint16_t fw, uint8_t type, uint8_t speed, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(speed);
+	uint8_t cols[30];
+
+	pix.clear();
+	pix.set_pix(0, 0, 1);
+	pix.set_pix(29, 6, 1);
+	pix.write(0x11, 0x22, 0x33, 0x44, 0x55, 2);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	bool pass = cols[0] == 0x01 && cols[29] == 0x40 && cols[10] == 0x11 && cols[14] == 0x55;
+
+	pix.clear();
+	pix.push_char('A');
+	pix.shift_char('B');
+	pix.show();
+	settle(chain);
+	pass = pass && expect_char(chain, 0, 'B') && expect_blank(chain, 1, 6);
+
+	pix.clear();
+	pix.push((char*)"xy");
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "xy", 4) && chain.errors() == 0;
+
+	for(const char* c = "0123456789ABCDEF"; *c != 0; c++){ // Wraps the ring several times
+		pix.push_char(*c);
+	}
+	pix.shift_char('s');
+	pix.write((char*)"Qq", 4);
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "sABCQq", 0);
+
+	pix.clear();
+	uint16_t width = pix.draw_text((char*)"ABCDEFGH", -3); // Clipped at both ends
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	const char* clipped = "ABCDEFGH";
+	for(int16_t x = 0; x < 30; x++){
+		uint8_t chr = clipped[(x+3)/5] - 32;
+		pass = pass && cols[x] == (pgm_read_byte(col+(chr*5 + (x+3)%5)) & 0x7F);
+	}
+	pass = pass && width == 30;
+	pass = pass && pix.draw_text((char*)"Z", 30) == 0 && pix.draw_text((char*)"Z", -5) == 0;
+	result(name, pass, chain);
+}
+
+static void check_blit(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	uint8_t cols[30];
+	uint8_t bars[4] = {0x7F, 0x0F, 0x55, 0x01};
+
+	pix.clear();
+	pix.blit(bars, 4, -1, 0);            // COPY, first column clipped
+	pix.blit(bars, 4, 28, 2, PIX_OP_OR);    // Moved down 2, last two clipped
+	pix.blit(bars, 4, 10, -3, PIX_OP_COPY); // Moved up 3
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	bool pass = cols[0] == 0x0F && cols[1] == 0x55 && cols[2] == 0x01 && cols[3] == 0;
+	pass = pass && cols[28] == 0x7C && cols[29] == 0x3C;
+	pass = pass && cols[10] == 0x0F && cols[11] == 0x01 && cols[12] == 0x0A && cols[13] == 0;
+
+	uint8_t full[3] = {0x7F, 0x7F, 0x7F};
+	uint8_t row[3]  = {0x08, 0x08, 0x08};
+	pix.clear();
+	pix.blit(full, 3, 0, 0);
+	pix.blit(row, 3, 0, 0, PIX_OP_ANDNOT);  // Punch out row 3
+	pix.blit(full, 3, 5, 0);
+	pix.blit(row, 3, 5, 0, PIX_OP_AND);     // Keep only row 3
+	pix.blit(row, 3, 6, 1, PIX_OP_XOR);     // Toggle row 4 on two columns
+	pix.blit(row, 1, 20, 5, PIX_OP_COPY);   // Row 8 is off the display
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && cols[0] == 0x77 && cols[2] == 0x77 && cols[5] == 0x08 && cols[6] == 0x18 && cols[7] == 0x18;
+	pass = pass && cols[20] == 0 && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// Per-pixel reference versions of the span primitives, all through set_pix()
+static void line_set_pix(Pixie& pix, int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+	int16_t dx = abs(x2-x1), dy = -abs(y2-y1);
+	int8_t sx = (x1 < x2) ? 1 : -1, sy = (y1 < y2) ? 1 : -1;
+	int16_t err = dx+dy;
+	while(true){
+		pix.set_pix(x1, y1, 1);
+		if(x1 == x2 && y1 == y2){
+			break;
+		}
+		int16_t e2 = 2*err;
+		if(e2 >= dy){ err += dy; x1 += sx; }
+		if(e2 <= dx){ err += dx; y1 += sy; }
+	}
+}
+
+static void circle_set_pix(Pixie& pix, int16_t x0, int16_t y0, int16_t r, bool fill){
+	int16_t x = r, y = 0, err = 1 - r;
+	while(x >= y){
+		int16_t pts[4][2] = {{x, y}, {y, x}, {(int16_t)-y, x}, {(int16_t)-x, y}};
+		for(uint8_t p = 0; p < 4; p++){
+			int16_t cx = x0 + pts[p][0];
+			int16_t h  = pts[p][1];
+			for(int16_t v = -h; v <= h; v += fill ? 1 : 2*h+(h == 0)){
+				pix.set_pix(cx, y0+v, 1);
+			}
+		}
+		y++;
+		if(err < 0){ err += 2*y + 1; }
+		else{ x--; err += 2*(y - x) + 1; }
+	}
+}
+
+// The draw_line() of library 1.3.0 and earlier
+static void old_draw_line(Pixie& pix, int16_t x1, int16_t y1, int16_t x2, int16_t y2){
+	int16_t x,y,dx,dy,dx1,dy1,px,py,xe,ye,i;
+	dx=x2-x1; dy=y2-y1; dx1=fabs(dx); dy1=fabs(dy); px=2*dy1-dx1; py=2*dx1-dy1;
+	if(dy1<=dx1){
+		if(dx>=0){ x=x1; y=y1; xe=x2; } else{ x=x2; y=y2; xe=x1; }
+		pix.set_pix(x,y,1);
+		for(i=0;x<xe;i++){
+			x=x+1;
+			if(px<0){ px=px+2*dy1; }
+			else{ if((dx<0 && dy<0) || (dx>0 && dy>0)){ y=y+1; } else{ y=y-1; } px=px+2*(dy1-dx1); }
+			delay(0);
+			pix.set_pix(x,y,1);
+		}
+	}
+	else{
+		if(dy>=0){ x=x1; y=y1; ye=y2; } else{ x=x2; y=y2; ye=y1; }
+		pix.set_pix(x,y,1);
+		for(i=0;y<ye;i++){
+			y=y+1;
+			if(py<=0){ py=py+2*dx1; }
+			else{ if((dx<0 && dy<0) || (dx>0 && dy>0)){ x=x+1; } else{ x=x-1; } py=py+2*(dx1-dy1); }
+			pix.set_pix(x,y,1);
+		}
+	}
+}
+
+static bool same_image(Pixie& a, Pixie& b, PixieChain& chain_a, PixieChain& chain_b){
+	uint8_t ca[2560], cb[2560];
+	host_attach(&chain_a, CLK_PIN, DATA_PIN);
+	a.show();
+	settle(chain_a);
+	host_attach(&chain_b, CLK_PIN, DATA_PIN);
+	b.show();
+	settle(chain_b);
+	chain_a.get_columns(ca);
+	chain_b.get_columns(cb);
+	return memcmp(ca, cb, chain_a.count()*10) == 0;
+}
+
+static void check_primitives(const char* name){
+	PixieChain chain(3, PIX_FW_130), ref_chain(3, PIX_FW_130);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, PRO_CRC);
+	pix.begin(FULL_SPEED);
+	host_attach(&ref_chain, CLK_PIN, DATA_PIN);
+	Pixie ref(3, CLK_PIN, DATA_PIN, PRO_CRC);
+	ref.begin(FULL_SPEED);
+	uint8_t cols[30];
+
+	pix.clear();
+	pix.fill_rect(2, 1, 4, 3);
+	pix.draw_rect(10, 0, 5, 7);
+	pix.draw_hline(-3, 6, 8);
+	pix.draw_vline(29, -2, 4);
+	pix.fill_rect(16, 0, 3, 7);
+	pix.fill_rect(17, 2, 9, 2, 0);   // Clears, clipped into the rect above
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	bool pass = cols[1] == 0x40 && cols[2] == 0x4E && cols[5] == 0x0E && cols[6] == 0;
+	pass = pass && cols[10] == 0x7F && cols[12] == 0x41 && cols[14] == 0x7F && cols[29] == 0x03;
+	pass = pass && cols[16] == 0x7F && cols[17] == 0x73 && cols[18] == 0x73;
+
+	int16_t lines[7][4] = {{0, 0, 29, 6}, {3, 6, 5, 0}, {28, 1, 2, 5}, {7, -4, 12, 12}, {20, 6, 26, 0}, {0, 0, 9, 6}, {-9, 2, 40, 3}};
+	for(uint8_t l = 0; l < 7; l++){
+		pix.clear();
+		ref.clear();
+		pix.draw_line(lines[l][0], lines[l][1], lines[l][2], lines[l][3]);
+		line_set_pix(ref, lines[l][0], lines[l][1], lines[l][2], lines[l][3]);
+		pass = pass && same_image(pix, ref, chain, ref_chain);
+	}
+	for(int16_t r = 0; r < 6; r++){
+		for(uint8_t fill = 0; fill < 2; fill++){
+			pix.clear();
+			ref.clear();
+			if(fill){
+				pix.fill_circle(14, 3, r);
+			}
+			else{
+				pix.draw_circle(14, 3, r);
+			}
+			circle_set_pix(ref, 14, 3, r, fill);
+			pass = pass && same_image(pix, ref, chain, ref_chain);
+		}
+	}
+	result(name, pass, chain);
+}
+
+static void check_canvas(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+
+	pix.canvas(20*5);
+	pix.write((char*)"Canvas drawn once!", 1);
+	pix.set_view(5*8);
+	pix.show();
+	settle(chain);
+	bool pass = expect_text(chain, "drawn ", 0);
+
+	pass = pass && pix.set_view(1000) && pix.get_view() == 20*5 - 30; // Clamped
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "once!", 0) && expect_blank(chain, 5, 6);
+
+	pix.set_view_mode(PIX_WRAP);
+	pass = pass && !pix.set_view(-5*2) && pix.get_view() == 18*5;
+	pix.show();
+	settle(chain);
+	pass = pass && expect_char(chain, 0, '!') && expect_blank(chain, 1, 3) && expect_text(chain, "Can", 3) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+static void check_prop_font(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	uint8_t cols[30];
+
+	pix.clear();
+	uint16_t width = pix.draw_text((char*)"1:1", 2, PIX_FONT_PROP);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	uint8_t ones[13] = {0, 0, 0x42, 0x7F, 0x40, 0, 0x36, 0x36, 0, 0x42, 0x7F, 0x40, 0};
+	bool pass = memcmp(cols, ones, 13) == 0 && width == 11 && pix.text_width((char*)"1:1", PIX_FONT_PROP) == 11;
+
+	pix.clear();
+	width = pix.draw_text((char*)"LT", -3, PIX_FONT_PROP); // Kerned, first glyph clipped
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && width == 8 && cols[0] == 0x40 && cols[1] == 0x40 && cols[2] == 0x01 && cols[4] == 0x7F && cols[7] == 0;
+
+	pix.clear();
+	pix.push((char*)"1:1", PIX_FONT_PROP);
+	pix.push((char*)"Te", PIX_FONT_PROP);  // Kerned: no gap between T and e
+	pix.shift((char*)"A", PIX_FONT_PROP);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && cols[0] == 0x7E && cols[4] == 0x7E && cols[5] == 0;           // A
+	pass = pass && cols[14] == 0x42 && cols[15] == 0x7F && cols[19] == 0x36;     // 1:1, moved by 11 then 6
+	pass = pass && cols[25] == 0x01 && cols[27] == 0x7F && cols[29] == 0x01;     // T, e pushed off the right edge
+	pass = pass && chain.errors() == 0;
+
+	pix.scroll_message((char*)"Hi!", PIX_FONT_PROP, 0);
+	settle(chain);
+	pass = pass && expect_blank(chain, 0, 6) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// Made with: python3 extras/pack_assets.py --rle bars.h BARS
+static const uint8_t bars_data[16] PROGMEM = {
+	0xF4, 0xEF, 0x30, 0x08, 0x01, 0x11, 0xAE, 0x39, 0x03, 0x05, 0x09, 0x11, 0x21, 0x41, 0x81, 0x0E,
+};
+static const uint16_t bars_index[3] PROGMEM = {0, 40, 64};
+static const PixieAssets BARS = {bars_data, bars_index, 3, 16, PIX_RLE};
+static const uint8_t bars[3][16] = {
+	{0x00,0x00,0x00,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x41,0x41,0x00},
+	{0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x1C},
+	{0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40}
+};
+
+static void check_assets(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	uint8_t cols[30];
+	uint8_t out[16];
+
+	// Spot checks across the pack, then every glyph of the packed font
+	uint8_t* icons[6] = {PIX_ARROW_UP, PIX_COPY, PIX_OHM, PIX_METEOR, PIX_U_ACUTE, PIX_THORN};
+	uint16_t ids[6]   = {PIX_ICON_ARROW_UP, PIX_ICON_COPY, PIX_ICON_OHM, PIX_ICON_METEOR, PIX_ICON_U_ACUTE, PIX_ICON_THORN};
+	bool pass = PIX_ICONS.count == 222 && pix.unpack(PIX_ICONS, 222, out) == 0;
+	for(uint8_t i = 0; i < 6; i++){
+		pass = pass && pix.unpack(PIX_ICONS, ids[i], out) == 5 && memcmp(out, icons[i], 5) == 0;
+	}
+	for(uint8_t g = 0; g < 96; g++){
+		pass = pass && pix.unpack(PIX_FONT_7BIT, g, out) == 5 && memcmp(out, col + g*5, 5) == 0;
+	}
+	for(uint8_t b = 0; b < 3; b++){
+		pass = pass && pix.unpack(BARS, b, out) == 16 && memcmp(out, bars[b], 16) == 0;
+	}
+
+	pix.clear();
+	pix.write(PIX_ICONS, PIX_ICON_HEART, 1);
+	pix.print(PIX_FONT_7BIT, 'A'-32);
+	pix.blit(BARS, 2, -11);                // RLE, first 11 columns clipped
+	pix.blit(BARS, 1, 20, 0, PIX_OP_XOR);  // RLE, last 6 columns clipped
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols+5, PIX_HEART, 5) == 0 && expect_char(chain, 2, 'A');
+	pass = pass && cols[0] == 0x40 && cols[4] == 0x40 && cols[20] == 0x08 && cols[29] == 0x08;
+
+	pix.clear();
+	pix.push(PIX_ICONS, PIX_ICON_SMILE);
+	pix.push(PIX_FONT_7BIT, 'z'-32);
+	pix.shift(PIX_ICONS, PIX_ICON_FROWN); // Pushes 'z' back off the right edge
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols, PIX_FROWN, 5) == 0 && memcmp(cols+25, PIX_SMILE, 5) == 0 && expect_blank(chain, 1, 5);
+
+	for(uint8_t s = 0; s < 2; s++){            // No such asset: nothing moves
+		if(s == 0){
+			pix.push(PIX_ICONS, PIX_ICONS.count);
+		}else{
+			pix.shift(PIX_ICONS, PIX_ICONS.count);
+		}
+		pix.show();
+		settle(chain);
+		chain.get_columns(cols);
+		pass = pass && memcmp(cols, PIX_FROWN, 5) == 0 && memcmp(cols+25, PIX_SMILE, 5) == 0 && expect_blank(chain, 1, 5);
+	}
+	pass = pass && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// é, →, an emoji (beyond U+FFFF), a Latin-1 é, Z, €
+static char utf8_text[] = "\xC3\xA9\xE2\x86\x92\xF0\x9F\x98\x80\xE9Z\xE2\x82\xAC";
+
+static void check_utf8(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	uint8_t cols[30];
+
+	pix.clear();
+	pix.write(utf8_text); // No extended glyphs yet: one space per character
+	pix.show();
+	settle(chain);
+	bool pass = pix.text_length(utf8_text) == 6 && expect_blank(chain, 0, 4) && expect_char(chain, 4, 'Z') && expect_blank(chain, 5, 6);
+
+	pix.set_glyphs(PIX_GLYPHS_EXT);
+	for(uint16_t i = 1; i < PIX_GLYPHS_EXT.count; i++){ // Binary search needs them sorted
+		pass = pass && pgm_read_word(ext_codepoint + i-1) < pgm_read_word(ext_codepoint + i);
+	}
+	pix.clear();
+	pix.write(utf8_text);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols, PIX_E_ACUTE, 5) == 0 && memcmp(cols+5, PIX_ARROW_RIGHT, 5) == 0 && expect_blank(chain, 2, 3);
+	pass = pass && memcmp(cols+15, PIX_E_ACUTE, 5) == 0 && expect_char(chain, 4, 'Z') && memcmp(cols+25, PIX_EURO, 5) == 0;
+	pass = pass && memcmp(pix.glyph((char)0xE1), PIX_A_ACUTE, 5) == 0;
+
+	pix.clear();
+	pix.push((char*)"AB");
+	pix.push((char*)"\xC3\xA9\xE2\x86\x92"); // 2 positions, not 5 bytes
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && expect_text(chain, "AB", 2) && memcmp(cols+20, PIX_E_ACUTE, 5) == 0 && memcmp(cols+25, PIX_ARROW_RIGHT, 5) == 0;
+
+	pix.clear();
+	uint16_t width = pix.draw_text((char*)"1\xE2\x82\xAC", 0, PIX_FONT_PROP);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && width == 10 && pix.text_width((char*)"1\xE2\x82\xAC", PIX_FONT_PROP) == 10;
+	pass = pass && cols[0] == 0x42 && cols[3] == 0 && memcmp(cols+4, PIX_EURO, 5) == 0 && cols[9] == 0;
+
+	pix.scroll_message(utf8_text, 0, true);
+	settle(chain);
+	pass = pass && expect_blank(chain, 0, 6) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+static void check_print(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.set_glyphs(PIX_GLYPHS_EXT);
+	PixiePrint out(pix);
+	uint8_t cols[30];
+
+	pix.clear();
+	out.print(F("T"));
+	out.print(-5);
+	out.write(0xC2); // "°" split over two calls
+	out.write(0xB0);
+	out.print("C");
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	bool pass = expect_text(chain, "T-5", 0) && memcmp(cols+15, PIX_DEGREES, 5) == 0 && expect_char(chain, 4, 'C');
+
+	pix.clear();
+	out.println(F("ABCD"));
+	out.write(0xC3);  // Cut short by 'x': Latin-1 "Ã"
+	out.print('x');
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols, pix.glyph((char)0xC3), 5) == 0 && cols[0] == 0x7A && expect_text(chain, "xCD", 1) && expect_blank(chain, 4, 6);
+
+	pix.clear();
+	out.set_mode(PIX_PRINT_PUSH);
+	out.print(255, HEX);
+	out.print(F("h"));
+	pix.show();
+	settle(chain);
+	pass = pass && expect_blank(chain, 0, 3) && expect_text(chain, "FFh", 3) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// PixieFixed has to send exactly the packets Pixie does
+template<class T> static void fixed_draw(T& pix){
+	pix.clear();
+	pix.write((char*)"Fix3d!");
+	pix.draw_line(0, 6, 29, 0);
+	pix.show();
+}
+
+template<uint8_t TYPE> static void check_fixed(uint16_t fw, const char* name){
+	PixieChain chain(3, fw), ref_chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	PixieFixed<3, TYPE, 60> pix(CLK_PIN, DATA_PIN);
+	pix.begin(FULL_SPEED);
+	host_attach(&ref_chain, CLK_PIN, DATA_PIN);
+	Pixie ref(3, CLK_PIN, DATA_PIN, TYPE);
+	ref.begin(FULL_SPEED);
+	uint8_t ca[30], cb[30];
+
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	fixed_draw(pix);
+	settle(chain);
+	host_attach(&ref_chain, CLK_PIN, DATA_PIN);
+	fixed_draw(ref);
+	settle(ref_chain);
+	chain.get_columns(ca);
+	ref_chain.get_columns(cb);
+	bool pass = memcmp(ca, cb, 30) == 0 && chain.bits == ref_chain.bits && chain.frames() == ref_chain.frames();
+
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	pix.canvas(100); // Only 60 columns of static storage
+	pix.set_view_mode(PIX_WRAP);
+	pix.write((char*)"ABCDEFGHIJKL");
+	pix.set_view(55);
+	pix.show();
+	settle(chain);
+	pass = pass && expect_char(chain, 0, 'L') && expect_text(chain, "ABCDE", 1) && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// Every number overload against the itoa()/sprintf() strings it used to write,
+// then padding and alignment
+// Labels rendered by PIXIE_TEXT() at compile time. The mixed one has a control
+// character, DEL, utf8_text's characters and a truncated sequence before 'A'.
+#define MIXED_TEXT "1\x01~\x7F\xC3\xA9\xE2\x86\x92\xF0\x9F\x98\x80\xE9Z\xE2\x82\xAC\xE2\x82" "A"
+#define LONG_TEXT  "The quick brown fox jumps over the lazy dog. 0123456789 " \
+                   "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG! \xC2\xB0" "C \xC2\xB1 \xCE\xA9"
+static constexpr auto FPS_LABEL   PROGMEM = PIXIE_TEXT("FPS!");
+static constexpr auto MIXED_LABEL PROGMEM = PIXIE_TEXT(MIXED_TEXT);
+static constexpr auto LONG_LABEL  PROGMEM = PIXIE_TEXT(LONG_TEXT);
+static_assert(sizeof(FPS_LABEL) == 20, "4 characters, 5 columns each");
+static_assert(FPS_LABEL.columns[0] == 0x7F && FPS_LABEL.columns[19] == 0x00, "F and the right edge of !");
+static_assert(PixieTextBuilder::length(MIXED_TEXT) == 13, "characters, not bytes");
+
+// Every column must be what the run-time renderer draws from the same string
+static bool same_as_runtime(Pixie& pix, const uint8_t* label, uint16_t width, const char* text){
+	char buf[160];
+	strcpy(buf, text);
+	char* input = buf;
+	uint16_t x = 0;
+	while(*input != 0){
+		if(memcmp(label + x, pix.next_glyph(input), 5) != 0){
+			return false;
+		}
+		x += 5;
+	}
+	return x == width && pix.text_length(buf) == width/5;
+}
+
+static void check_text(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.set_glyphs(PIX_GLYPHS_EXT);
+	uint8_t cols[30];
+
+	bool pass = same_as_runtime(pix, FPS_LABEL.columns, sizeof(FPS_LABEL), "FPS!");
+	pass = pass && same_as_runtime(pix, MIXED_LABEL.columns, sizeof(MIXED_LABEL), MIXED_TEXT);
+	pass = pass && same_as_runtime(pix, LONG_LABEL.columns, sizeof(LONG_LABEL), LONG_TEXT);
+
+	pix.clear();
+	pix.write(FPS_LABEL, 1);
+	pix.print('9');
+	pix.show();
+	settle(chain);
+	pass = pass && expect_blank(chain, 0, 1) && expect_text(chain, "FPS!9", 1);
+
+	pix.clear();
+	uint16_t width = pix.draw_text(MIXED_LABEL, -3);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && width == 30 && memcmp(cols, MIXED_LABEL.columns + 3, 30) == 0;
+
+	pix.clear();
+	pix.canvas(sizeof(LONG_LABEL)); // Wider than put_columns() used to take
+	width = pix.draw_text(LONG_LABEL, 0);
+	pix.set_view(sizeof(LONG_LABEL) - 30);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && width == sizeof(LONG_LABEL) && memcmp(cols, LONG_LABEL.columns + sizeof(LONG_LABEL) - 30, 30) == 0;
+	result(name, pass, chain);
+}
+
+// PWM level the modules are showing, module 0 first (display positions 0-1)
+static bool expect_pwm(PixieChain& chain, const uint8_t* levels){
+	for(uint8_t m = 0; m < chain.count(); m++){
+		if(chain.module_at_position(m*2).pwm != levels[m]){
+			if(verbose){
+				printf("    module %u: pwm %u, expected %u\n", m, chain.module_at_position(m*2).pwm, levels[m]);
+			}
+			return false;
+		}
+	}
+	return true;
+}
+
+static void check_brightness(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	settle(chain);
+
+	uint8_t levels[3] = {10, 60, 120};
+	uint32_t frames = chain.frames();
+	pix.set_brightness(levels); // Batched: no frames until show()
+	pix.write((char*)"ABCDEF");
+	bool pass = chain.frames() == frames && pix.get_brightness(1) == 60;
+	pix.show();
+	settle(chain);
+	pass = pass && chain.frames() == frames + 1 && expect_pwm(chain, levels) && expect_text(chain, "ABCDEF", 0);
+
+	pix.command(PIX_ROW_CURRENT, mA_10); // Ignored by LEGACY
+	pix.show();
+	settle(chain);
+	pass = pass && expect_pwm(chain, levels); // The map survives commands and regular frames
+
+	frames = chain.frames();
+	pix.brightness(40);
+	settle(chain);
+	uint8_t all40[3] = {40, 40, 40};
+	pass = pass && chain.frames() == frames + 1 && expect_pwm(chain, all40);
+
+	// Per-module fades, merged into the regular frames: one frame per show()
+	PixieFader fader(pix);
+	uint8_t targets[3] = {127, 0, 64};
+	fader.fade_to(targets, 300, PIX_EASE_LINEAR);
+	frames = chain.frames();
+	uint16_t shows = 0;
+	uint8_t prev[3] = {40, 40, 40};
+	while(!fader.done()){
+		fader.update();
+		pix.show();
+		shows++;
+		pass = pass && pix.get_brightness(0) >= prev[0] && pix.get_brightness(1) <= prev[1] && pix.get_brightness(2) >= prev[2];
+		for(uint8_t m = 0; m < 3; m++){
+			prev[m] = pix.get_brightness(m);
+		}
+	}
+	settle(chain);
+	pass = pass && shows > 3 && chain.frames() == frames + shows && expect_pwm(chain, targets);
+
+	// Easing at a known time: 0 to 100 over 1000 ms
+	const uint8_t eases[4]   = {PIX_EASE_LINEAR, PIX_EASE_IN, PIX_EASE_OUT, PIX_EASE_IN_OUT};
+	const uint16_t at[4]     = {500, 500, 250, 500};
+	const uint8_t expect[4]  = {50, 25, 43, 50};
+	for(uint8_t e = 0; e < 4; e++){
+		pix.set_brightness(0, 0);
+		fader.fade_to(100, 1000, eases[e], 0);
+		delay(at[e]);
+		fader.update();
+		pass = pass && pix.get_brightness(0) == expect[e] && !fader.done();
+		if(verbose){
+			printf("    ease %u at %u ms: %u, expected %u\n", eases[e], at[e], pix.get_brightness(0), expect[e]);
+		}
+	}
+	fader.fade_to(5, 0);
+	pass = pass && fader.update() && pix.get_brightness(2) == 5 && fader.done() && !fader.update();
+	result(name, pass, chain);
+}
+
+// A gradient of every level across the chain, a pixel and a line of text
+static void gray_scene(PixieGray& gray){
+	uint8_t top = gray.levels() - 1;
+	for(int16_t x = 0; x < 30; x++){
+		gray.put_column(x, 0x7F, x * gray.levels() / 30);
+	}
+	gray.set_pix(29, 3, 0);
+	gray.draw_text((char*)"Hi", 10, top);
+}
+
+static void check_gray(uint16_t fw, uint8_t type, uint8_t speed, uint8_t bits, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(speed);
+	settle(chain);
+	PixieGray gray(pix, bits);
+	uint8_t top = gray.levels() - 1;
+	bool pass = gray.levels() == (1 << bits);
+	for(uint8_t level = 0; level < gray.levels(); level++){ // Every level reads back
+		gray.set_pix(0, 6, level);
+		pass = pass && gray.get_pix(0, 6) == level;
+	}
+	gray.set_pix(0, 5, 200); // Clamped to the top level
+	pass = pass && gray.get_pix(0, 5) == top;
+	gray.clear();
+	gray_scene(gray);
+
+	// Each frame sent is the next bit plane
+	uint8_t cols[30];
+	for(uint8_t n = 0; n < bits*2; n++){
+		while(!gray.update()){
+			delayMicroseconds(20);
+		}
+		chain.get_columns(cols);
+		uint8_t plane = n % bits;
+		for(int16_t x = 0; x < 30; x++){
+			uint8_t expect = 0;
+			for(uint8_t y = 0; y < 7; y++){
+				expect |= ((gray.get_pix(x, y) >> plane) & 1) << y;
+			}
+			pass = pass && cols[x] == expect;
+		}
+	}
+
+	// Time each pixel is lit over 20 cycles, against its level
+	uint32_t on_us[30][7];
+	memset(on_us, 0, sizeof(on_us));
+	uint32_t t_start = micros();
+	uint32_t t_prev  = t_start;
+	chain.get_columns(cols);
+	while(micros() - t_start < gray.cycle_us() * 20){
+		gray.update();
+		delayMicroseconds(50);
+		uint32_t now = micros();
+		for(uint8_t x = 0; x < 30; x++){ // The previous image stayed up until now
+			for(uint8_t y = 0; y < 7; y++){
+				if((cols[x] >> y) & 1){
+					on_us[x][y] += now - t_prev;
+				}
+			}
+		}
+		t_prev = now;
+		chain.get_columns(cols);
+	}
+	float worst = 0;
+	for(uint8_t x = 0; x < 30; x++){
+		for(uint8_t y = 0; y < 7; y++){
+			float duty = (float)on_us[x][y] / (t_prev - t_start);
+			float err  = fabs(duty - (float)gray.get_pix(x, y) / top);
+			if(err > worst){
+				worst = err;
+			}
+		}
+	}
+	if(verbose){
+		printf("    %u levels, cycle %u us, worst duty error %.3f\n", gray.levels(), gray.cycle_us(), worst);
+	}
+	pass = pass && worst < 0.5f / top && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// Animations packed by extras/pack_animation.py: the 24 icons of
+// examples/07_Animation (--ms 40), and a ball bouncing between two lines
+// across 3 modules (--ms 30), made by ball_frame() below.
+// 24 frames, 5 columns each, keyframe + XOR deltas: 65 bytes of flash instead of 120.
+
+static const uint8_t pix_anim_spin_data[65] PROGMEM = {
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x04, 0x01, 0x08, 0x01, 0x10, 0x01, 0x11, 0x01, 0x02,
+	0x12, 0x01, 0x04, 0x14, 0x01, 0x08, 0x18, 0x01, 0x10, 0x10, 0x21, 0x10, 0x42, 0x18, 0x40, 0x04,
+	0x14, 0x40, 0x08, 0x12, 0x40, 0x10, 0x11, 0x40, 0x20, 0x11, 0x20, 0x40, 0x09, 0x10, 0x40, 0x05,
+	0x08, 0x40, 0x03, 0x04, 0x40, 0x01, 0x42, 0x01, 0x21, 0x01, 0x10, 0x01, 0x08, 0x01, 0x04, 0x01,
+	0x02,
+};
+
+static const PixieAnimation PIX_ANIM_SPIN = {pix_anim_spin_data, NULL, 24, 40, 5};
+// 56 frames, 30 columns each, keyframe + XOR deltas: 422 bytes of flash instead of 1680.
+
+static const uint8_t pix_anim_ball_data[422] PROGMEM = {
+	0x47, 0x47, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x07, 0x00,
+	0x00, 0x00, 0x06, 0x0A, 0x0C, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x14, 0x18, 0x1C, 0x00, 0x00, 0x00,
+	0x18, 0x28, 0x30, 0x38, 0x00, 0x00, 0x00, 0x30, 0x28, 0x18, 0x70, 0x00, 0x00, 0x00, 0x18, 0x14,
+	0x0C, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0x0A, 0x06, 0xC0, 0x01, 0x00, 0x00, 0x06, 0x0A, 0x0C, 0x80,
+	0x03, 0x00, 0x00, 0x0C, 0x14, 0x18, 0x00, 0x07, 0x00, 0x00, 0x18, 0x28, 0x30, 0x00, 0x0E, 0x00,
+	0x00, 0x30, 0x28, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x14, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x0C,
+	0x0A, 0x06, 0x00, 0x70, 0x00, 0x00, 0x06, 0x0A, 0x0C, 0x00, 0xE0, 0x00, 0x00, 0x0C, 0x14, 0x18,
+	0x00, 0xC0, 0x01, 0x00, 0x18, 0x28, 0x30, 0x00, 0x80, 0x03, 0x00, 0x30, 0x28, 0x18, 0x00, 0x00,
+	0x07, 0x00, 0x18, 0x14, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x0A, 0x06, 0x00, 0x00, 0x1C, 0x00,
+	0x06, 0x0A, 0x0C, 0x00, 0x00, 0x38, 0x00, 0x0C, 0x14, 0x18, 0x00, 0x00, 0x70, 0x00, 0x18, 0x28,
+	0x30, 0x00, 0x00, 0xE0, 0x00, 0x30, 0x28, 0x18, 0x00, 0x00, 0xC0, 0x01, 0x18, 0x14, 0x0C, 0x00,
+	0x00, 0x80, 0x03, 0x0C, 0x0A, 0x06, 0x00, 0x00, 0x00, 0x07, 0x06, 0x0A, 0x0C, 0x00, 0x00, 0x00,
+	0x0E, 0x0C, 0x14, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x18, 0x28, 0x30, 0x00, 0x00, 0x00, 0x38, 0x30,
+	0x28, 0x18, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x14, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x06, 0x0A, 0x0C,
+	0x00, 0x00, 0x00, 0x0E, 0x0C, 0x0A, 0x06, 0x00, 0x00, 0x00, 0x07, 0x18, 0x14, 0x0C, 0x00, 0x00,
+	0x80, 0x03, 0x30, 0x28, 0x18, 0x00, 0x00, 0xC0, 0x01, 0x18, 0x28, 0x30, 0x00, 0x00, 0xE0, 0x00,
+	0x0C, 0x14, 0x18, 0x00, 0x00, 0x70, 0x00, 0x06, 0x0A, 0x0C, 0x00, 0x00, 0x38, 0x00, 0x0C, 0x0A,
+	0x06, 0x00, 0x00, 0x1C, 0x00, 0x18, 0x14, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x30, 0x28, 0x18, 0x00,
+	0x00, 0x07, 0x00, 0x18, 0x28, 0x30, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x14, 0x18, 0x00, 0xC0, 0x01,
+	0x00, 0x06, 0x0A, 0x0C, 0x00, 0xE0, 0x00, 0x00, 0x0C, 0x0A, 0x06, 0x00, 0x70, 0x00, 0x00, 0x18,
+	0x14, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x30, 0x28, 0x18, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x28, 0x30,
+	0x00, 0x0E, 0x00, 0x00, 0x0C, 0x14, 0x18, 0x00, 0x07, 0x00, 0x00, 0x06, 0x0A, 0x0C, 0x80, 0x03,
+	0x00, 0x00, 0x0C, 0x0A, 0x06, 0xC0, 0x01, 0x00, 0x00, 0x18, 0x14, 0x0C, 0xE0, 0x00, 0x00, 0x00,
+	0x30, 0x28, 0x18, 0x70, 0x00, 0x00, 0x00, 0x18, 0x28, 0x30, 0x38, 0x00, 0x00, 0x00, 0x0C, 0x14,
+	0x18, 0x1C, 0x00, 0x00, 0x00, 0x06, 0x0A, 0x0C, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x0A, 0x06, 0x07,
+	0x00, 0x00, 0x00, 0x06, 0x0A, 0x0C,
+};
+
+static const PixieAnimation PIX_ANIM_BALL = {pix_anim_ball_data, NULL, 56, 30, 30};
+
+static const uint16_t spin_pause_ms[24] PROGMEM = {
+	400, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 200, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40
+};
+static const PixieAnimation SPIN_PAUSE = {pix_anim_spin_data, spin_pause_ms, 24, 40, 5};
+
+static const uint8_t spin_frames[24][5] = { // examples/07_Animation
+	{0x01,0x00,0x00,0x00,0x00},
+	{0x01,0x01,0x00,0x00,0x00},
+	{0x01,0x01,0x01,0x00,0x00},
+	{0x01,0x01,0x01,0x01,0x00},
+	{0x01,0x01,0x01,0x01,0x01},
+	{0x00,0x01,0x01,0x01,0x03},
+	{0x00,0x00,0x01,0x01,0x07},
+	{0x00,0x00,0x00,0x01,0x0F},
+	{0x00,0x00,0x00,0x00,0x1F},
+	{0x00,0x00,0x00,0x00,0x3E},
+	{0x00,0x00,0x00,0x00,0x7C},
+	{0x00,0x00,0x00,0x40,0x78},
+	{0x00,0x00,0x40,0x40,0x70},
+	{0x00,0x40,0x40,0x40,0x60},
+	{0x40,0x40,0x40,0x40,0x40},
+	{0x60,0x40,0x40,0x40,0x00},
+	{0x70,0x40,0x40,0x00,0x00},
+	{0x78,0x40,0x00,0x00,0x00},
+	{0x7C,0x00,0x00,0x00,0x00},
+	{0x3E,0x00,0x00,0x00,0x00},
+	{0x1F,0x00,0x00,0x00,0x00},
+	{0x0F,0x00,0x00,0x00,0x00},
+	{0x07,0x00,0x00,0x00,0x00},
+	{0x03,0x00,0x00,0x00,0x00},
+};
+
+static uint8_t bounce(uint16_t t, uint8_t n){
+	uint16_t p = t % (2*(n-1));
+	return p < n ? p : 2*(n-1) - p;
+}
+
+static void ball_frame(uint16_t f, uint8_t* cols){
+	memset(cols, 0x41, 30);
+	uint8_t x = bounce(f, 29);
+	uint8_t y = 1 + bounce(f, 4);
+	cols[x]   |= (3 << y) & 0x7F;
+	cols[x+1] |= (3 << y) & 0x7F;
+}
+
+// show_changes() sends only what mark_dirty() was told of: the plain writers
+// leave the chain alone until they are marked or show() is called
+static void check_show_changes(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.write((char*)"ABCDEF");
+	pix.show();
+	settle(chain);
+	uint32_t frames = chain.frames();
+
+	pix.write((char*)"Z", 0);
+	pix.print((char*)"Y");
+	pix.push('X');
+	pix.shift('W');
+	pix.set_pix(12, 3, 1);
+	pix.draw_line(0, 0, 29, 6);
+	pix.draw_rect(20, 1, 5, 5);
+	bool pass = !pix.show_changes(); // Nothing marked, nothing sent
+	settle(chain);
+	pass = pass && chain.frames() == frames && expect_text(chain, "ABCDEF", 0);
+
+	pix.clear();
+	pix.write((char*)"GH", 2);
+	pix.mark_dirty(10, 5);           // Only the module holding "G" and "H"
+	pass = pass && pix.show_changes();
+	settle(chain);
+	pass = pass && chain.frames() > frames && expect_text(chain, "ABGHEF", 0);
+	pass = pass && !pix.show_changes(); // Sent, so unmarked again
+	pix.show();
+	settle(chain);
+	pass = pass && expect_blank(chain, 0, 2) && expect_text(chain, "GH", 2) && expect_blank(chain, 4, 6);
+	pass = pass && chain.errors() == 0;
+	result(name, pass, chain);
+}
+
+// Waits for the next frame, then sends only the modules it changed
+static void next_frame(PixiePlayer& player, Pixie& pix, PixieChain& chain){
+	while(!player.update()){
+		delay(1);
+	}
+	pix.show_changes();
+	settle(chain);
+}
+
+static void check_player(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.write((char*)"ABCD");
+	pix.show();
+	settle(chain);
+	PixiePlayer player(pix);
+	uint8_t cols[30];
+
+	// The spinner on the last module: only its packet is encoded again
+	player.begin(PIX_ANIM_SPIN, 25);
+	pix.show_changes();
+	settle(chain);
+	bool pass = true;
+	for(uint8_t n = 0; n < 30; n++){ // Past the end, so it loops
+		if(n > 0){
+			next_frame(player, pix, chain);
+		}
+		chain.get_columns(cols);
+		pass = pass && memcmp(cols + 25, spin_frames[player.frame()], 5) == 0;
+	}
+	pass = pass && expect_text(chain, "ABCD", 0) && !player.done();
+	pass = pass && !pix.show_changes(); // Nothing marked, nothing sent
+	pix.write((char*)"Z", 0);           // Not marked: left as encoded before
+	player.draw();
+	pass = pass && pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "ABCD", 0);
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "ZBCD", 0);
+
+	// The ball across the whole chain, once
+	pix.clear();
+	player.begin(PIX_ANIM_BALL, 0, false);
+	pix.show_changes();
+	settle(chain);
+	uint8_t seen = 0;
+	while(!player.done()){ // Sending takes about as long as a frame here, so some are skipped
+		uint8_t expect[30];
+		ball_frame(player.frame(), expect);
+		chain.get_columns(cols);
+		pass = pass && memcmp(cols, expect, 30) == 0;
+		seen++;
+		if(player.frame() == 55){
+			delay(30);
+			bool changed = player.update();
+			pass = pass && !changed;
+		}
+		else{
+			next_frame(player, pix, chain);
+		}
+	}
+	pass = pass && seen > 28 && player.frame() == 55;
+
+	// Per-frame durations, and draw() after clear()
+	player.begin(SPIN_PAUSE, 10);
+	delay(399);
+	pass = pass && !player.update() && player.frame() == 0;
+	delay(1);
+	pass = pass && player.update() && player.frame() == 1;
+	delay(40 * 11);
+	pass = pass && player.update() && player.frame() == 12;
+	delay(199);
+	pass = pass && !player.update();
+	pix.clear();
+	player.draw();
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols + 10, spin_frames[12], 5) == 0 && expect_blank(chain, 0, 1) && expect_blank(chain, 3, 5);
+	result(name, pass, chain);
+}
+
+static void check_layers(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	PixieLayers layers(pix);
+	PixieLayer clock(pix, 0, 20);       // Positions 0-3
+	PixieLayer ticker(pix, 20, 10, 40); // Positions 4-5, 8 characters to scroll through
+	clock.draw_text((char*)"12:3", 0);
+	ticker.draw_text((char*)"NEWS ON ", 0);
+	layers.add(clock);
+	layers.add(ticker);
+	bool pass = layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:3NE", 0);
+	pass = pass && !layers.compose() && !layers.show(); // Nothing changed
+
+	// Scrolling the ticker composes its columns only
+	pix.write((char*)"Z", 0); // Straight into the frame, not through a layer
+	ticker.scroll(5);
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:3EW", 0);
+	pix.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "Z2:3EW", 0);
+	ticker.scroll(30); // Wraps: the last blank, then the start again
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "Z2:3 N", 0);
+	ticker.scroll_to(5);
+
+	// An overlay and back, without drawing the clock or ticker again
+	PixieLayer note(pix, 5, 20);
+	note.draw_text((char*)"!OK!", 0);
+	pass = pass && layers.push(note);
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "Z!OK!W", 0);
+	pass = pass && layers.pop() == &note;
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "Z2:3EW", 0);
+
+	// A layer over the bottom two rows only, then under the clock
+	PixieLayer bar(pix, 0, 10);
+	for(uint8_t x = 0; x < 10; x++){
+		bar.put_column(x, 0x7F);
+	}
+	bar.set_rows(5, 2);
+	layers.add(bar);
+	layers.show();
+	settle(chain);
+	uint8_t cols[30];
+	chain.get_columns(cols);
+	const char* digits = "12";
+	for(uint8_t x = 0; x < 10; x++){
+		uint8_t glyph_col = pgm_read_byte(col + (digits[x/5]-32)*5 + x%5);
+		pass = pass && cols[x] == ((glyph_col & 0x1F) | 0x60);
+	}
+	layers.add(clock, 1); // Above the bar now
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:3EW", 0);
+	clock.set_visible(false);
+	layers.show();
+	settle(chain);
+	chain.get_columns(cols);
+	for(uint8_t x = 0; x < 20; x++){
+		pass = pass && cols[x] == (x < 10 ? 0x60 : 0);
+	}
+	clock.set_visible(true);
+	layers.remove(bar);
+	ticker.move(25);
+	layers.show();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:3 E", 0);
+	pass = pass && layers.pop() == &clock && layers.pop() == &ticker && layers.pop() == NULL;
+
+	// Moved, then removed before a compose(): where it was is uncovered too
+	PixieLayer block(pix, 0, 5);
+	for(uint8_t x = 0; x < 5; x++){
+		block.put_column(x, 0x7F);
+	}
+	layers.add(block);
+	layers.show();
+	settle(chain);
+	block.move(10);
+	layers.remove(block);
+	layers.show();
+	settle(chain);
+	chain.get_columns(cols);
+	for(uint8_t x = 0; x < 15; x++){
+		pass = pass && cols[x] == 0;
+	}
+	result(name, pass, chain);
+}
+
+// What PIX_ROLL_UP/DOWN, PIX_WIPE_RIGHT/LEFT and PIX_FLIP show at **step**,
+// pixel by pixel
+static uint8_t transition_column(uint8_t effect, const uint8_t* a, const uint8_t* b, uint16_t x, uint16_t width, uint16_t step){
+	uint8_t col = 0;
+	bool flips = memcmp(a + x/5*5, b + x/5*5, 5) != 0;
+	for(uint8_t r = 0; r < 7; r++){
+		bool on = false;
+		if(effect == PIX_ROLL_UP){
+			on = r + step < 7 ? bitRead(a[x], r + step) : bitRead(b[x], r + step - 7);
+		}
+		else if(effect == PIX_ROLL_DOWN){
+			on = r >= step ? bitRead(a[x], r - step) : bitRead(b[x], r + 7 - step);
+		}
+		else if(effect == PIX_WIPE_RIGHT){
+			on = bitRead(x < step ? b[x] : a[x], r);
+		}
+		else if(effect == PIX_WIPE_LEFT){
+			on = bitRead(x + step >= width ? b[x] : a[x], r);
+		}
+		else if(effect == PIX_FLIP){
+			on = !flips ? bitRead(b[x], r) : r < step ? bitRead(b[x], r) : bitRead(a[x], r);
+			on = on || (flips && r == step && step > 0 && step < 7);
+		}
+		col |= on << r;
+	}
+	return col;
+}
+
+static void check_transition(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	PixieTransition trans(pix);
+	uint8_t a[30], b[30], cols[30];
+	const char* texts[6][2] = {
+		{"ABCDEF", "UVWXYZ"}, {"ABCDEF", "UVWXYZ"}, {"ABCDEF", "UVWXYZ"},
+		{"ABCDEF", "UVWXYZ"}, {"ABCDEF", "UVWXYZ"}, {"12:34 ", "12:35 "}
+	};
+	const uint16_t steps[6] = {7, 7, 30, 30, 15, 7};
+	bool pass = true;
+	for(uint8_t effect = PIX_ROLL_UP; effect <= PIX_FLIP; effect++){
+		pix.clear();
+		pix.write((char*)texts[effect][0], 0);
+		pix.show();
+		settle(chain);
+		chain.get_columns(a);
+		trans.capture();
+		pix.clear();
+		pix.write((char*)texts[effect][1], 0);
+		pix.show(); // What begin() has to take back
+		settle(chain);
+		chain.get_columns(b);
+		trans.begin(effect, 300);
+		pix.show_changes();
+		settle(chain);
+		chain.get_columns(cols);
+		pass = pass && memcmp(cols, a, 30) == 0 && !trans.done();
+
+		// Every frame sent is a step of the effect, in order
+		uint16_t step = 0;
+		uint8_t  sent = 0;
+		uint8_t  last[30];
+		memcpy(last, a, 30);
+		while(!trans.done()){
+			if(!trans.update()){
+				delay(1);
+				continue;
+			}
+			pix.show_changes();
+			settle(chain);
+			sent++;
+			chain.get_columns(cols);
+			if(effect == PIX_DISSOLVE){ // Each pixel goes from old to new once
+				for(uint8_t x = 0; x < 30; x++){
+					pass = pass && ((cols[x] ^ a[x]) & (cols[x] ^ b[x])) == 0;
+					pass = pass && ((last[x] ^ a[x]) & ~(cols[x] ^ a[x])) == 0;
+				}
+				memcpy(last, cols, 30);
+				continue;
+			}
+			bool found = false;
+			for(; step <= steps[effect] && !found; step++){
+				found = true;
+				for(uint8_t x = 0; x < 30 && found; x++){
+					found = cols[x] == transition_column(effect, a, b, x, 30, step);
+				}
+			}
+			step--;
+			pass = pass && found;
+		}
+		chain.get_columns(cols);
+		pass = pass && memcmp(cols, b, 30) == 0 && sent >= 4;
+		if(effect == PIX_FLIP){ // Positions that don't change never move
+			pass = pass && memcmp(cols, a, 20) == 0;
+		}
+	}
+
+	// stop() and ms = 0 end on the new frame at once
+	pix.clear();
+	pix.write((char*)"OLD", 0);
+	trans.capture();
+	pix.write((char*)"NEW", 0);
+	trans.begin(PIX_ROLL_DOWN, 1000);
+	delay(300);
+	trans.update();
+	trans.stop();
+	pass = pass && trans.done() && !trans.update();
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "NEW", 0);
+	trans.capture();
+	pix.write((char*)"NOW", 0);
+	trans.begin(PIX_DISSOLVE, 0);
+	pass = pass && trans.done();
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "NOW", 0);
+
+	// A PIX_WRAP viewport near the canvas end: its right part is the canvas start
+	pix.canvas(60);
+	pix.set_view_mode(PIX_WRAP);
+	pix.set_view(45);
+	pix.write((char*)"ABC", 9);    // Columns 45-59
+	pix.write((char*)"DEF", 0);    // Columns 0-14, shown on the right
+	pix.show();
+	settle(chain);
+	chain.get_columns(a);
+	pass = pass && expect_text(chain, "ABCDEF", 0);
+	trans.capture();
+	pix.write((char*)"UVW", 9);
+	pix.write((char*)"XYZ", 0);
+	pix.show();
+	settle(chain);
+	chain.get_columns(b);
+	trans.begin(PIX_ROLL_UP, 300);
+	pix.show_changes();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols, a, 30) == 0;
+	bool stepped = false;
+	while(!trans.done()){
+		if(!trans.update()){
+			delay(1);
+			continue;
+		}
+		pix.show_changes();
+		settle(chain);
+		chain.get_columns(cols);
+		bool found = false;
+		for(uint16_t step = 1; step <= 7 && !found; step++){
+			found = true;
+			for(uint8_t x = 0; x < 30 && found; x++){
+				found = cols[x] == transition_column(PIX_ROLL_UP, a, b, x, 30, step);
+			}
+		}
+		pass = pass && found;
+		stepped = true;
+	}
+	pass = pass && stepped && expect_text(chain, "UVWXYZ", 0);
+	result(name, pass, chain);
+}
+
+// **cols** as a chain mounted in **mode** shows them
+static void orient_columns(const uint8_t* cols, uint8_t* out, uint16_t width, uint8_t mode){
+	for(uint16_t x = 0; x < width; x++){
+		uint8_t col = (mode & PIX_MIRROR_X) ? cols[width-1 - x] : cols[x];
+		if(mode & PIX_MIRROR_Y){
+			uint8_t rev = 0;
+			for(uint8_t r = 0; r < 7; r++){
+				rev |= bitRead(col, r) << (6 - r);
+			}
+			col = rev;
+		}
+		out[x] = col;
+	}
+}
+
+static void check_orientation(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.write((char*)"Ab1");
+	pix.draw_line(15, 0, 29, 6);
+	pix.set_pix(16, 6, 1);
+	pix.show();
+	settle(chain);
+	uint8_t normal[30], cols[30], expect[30];
+	chain.get_columns(normal);
+	bool pass = pix.get_orientation() == PIX_NORMAL;
+	for(uint8_t mode = PIX_MIRROR_X; mode <= PIX_ROTATE_180; mode++){
+		pix.set_orientation(mode);
+		pix.show();
+		settle(chain);
+		chain.get_columns(cols);
+		orient_columns(normal, expect, 30, mode);
+		pass = pass && memcmp(cols, expect, 30) == 0 && pix.get_orientation() == mode;
+	}
+	pix.flipped(false);
+	pass = pass && pix.get_orientation() == PIX_NORMAL;
+	pix.flipped();
+	pass = pass && pix.get_orientation() == PIX_ROTATE_180;
+
+	// show_changes() re-encodes the module the marked columns land on
+	pix.show();
+	settle(chain);
+	pix.write_byte(0x7F, 0);
+	pix.mark_dirty(0, 1);
+	pix.write_byte(0x7F, 29); // Not marked
+	pass = pass && pix.show_changes();
+	settle(chain);
+	chain.get_columns(cols);
+	orient_columns(normal, expect, 30, PIX_ROTATE_180);
+	expect[29] = 0x7F;
+	pass = pass && memcmp(cols, expect, 30) == 0;
+
+	// A viewport into a canvas, mirrored
+	pix.canvas(60);
+	for(uint8_t x = 0; x < 60; x++){
+		pix.write_byte(x, x);
+	}
+	pix.set_view(20);
+	pix.set_orientation(PIX_MIRROR_X);
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	for(uint8_t x = 0; x < 30; x++){
+		pass = pass && cols[x] == 20 + 29 - x;
+	}
+
+	// PixieFixed falls back to Pixie::encode() when not PIX_NORMAL
+	if(type == PRO){
+		PixieFixed<3, PRO> fixed(CLK_PIN, DATA_PIN);
+		fixed.begin(FULL_SPEED);
+		fixed.write((char*)"Ab1");
+		fixed.draw_line(15, 0, 29, 6);
+		fixed.set_pix(16, 6, 1);
+		fixed.flipped();
+		fixed.show();
+		settle(chain);
+		chain.get_columns(cols);
+		orient_columns(normal, expect, 30, PIX_ROTATE_180);
+		pass = pass && memcmp(cols, expect, 30) == 0;
+	}
+	result(name, pass, chain);
+}
+
+// **cols** with the attributes of each position applied, in blink phase **on**
+static void attr_columns(const uint8_t* cols, const uint8_t* attrs, bool on, uint8_t* out, uint16_t width){
+	for(uint16_t x = 0; x < width; x++){
+		uint8_t a = attrs[x / 5];
+		uint8_t col = cols[x];
+		if(a & PIX_UNDERLINE){
+			col |= 0x40;
+		}
+		if(a & PIX_INVERT){
+			col ^= 0x7F;
+		}
+		if(a & PIX_DIM){
+			col &= (x % 5) % 2 ? 0x2A : 0x55;
+		}
+		if((a & PIX_BLINK) && !on){
+			col = 0;
+		}
+		out[x] = col;
+	}
+}
+
+static void check_attributes(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(3, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(3, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	pix.write((char*)"Ab1:5 ");
+	pix.show();
+	settle(chain);
+	uint8_t normal[30], cols[30], expect[30], oriented[30];
+	chain.get_columns(normal);
+	uint8_t attrs[6] = {0, PIX_INVERT, PIX_UNDERLINE, PIX_BLINK, PIX_DIM, PIX_BLINK | PIX_UNDERLINE | PIX_INVERT};
+	for(uint8_t i = 0; i < 6; i++){
+		pix.set_attribute(i, attrs[i]);
+	}
+	bool pass = pix.show_changes();
+	settle(chain);
+	chain.get_columns(cols);
+	attr_columns(normal, attrs, true, expect, 30);
+	pass = pass && memcmp(cols, expect, 30) == 0;
+	for(uint8_t x = 0; x < 30; x++){ // Applied on the wire only
+		pass = pass && pix.read_byte(x) == normal[x];
+	}
+	pass = pass && pix.get_attribute(5) == attrs[5] && pix.get_attribute(6) == 0;
+
+	// The blink phase marks only the modules with blinking positions
+	pix.set_blink_phase(false);
+	pix.write_byte(0x7F, 0); // Module 0, not marked
+	pass = pass && pix.show_changes();
+	settle(chain);
+	chain.get_columns(cols);
+	attr_columns(normal, attrs, false, expect, 30);
+	pass = pass && memcmp(cols, expect, 30) == 0;
+	pix.write_byte(normal[0], 0);
+	pix.set_blink_phase(false);
+	pass = pass && !pix.show_changes();
+
+	// update_blink() follows millis()
+	bool flipped = false;
+	for(uint8_t t = 0; t < 100 && !flipped; t++){
+		flipped = pix.update_blink(50);
+		if(!flipped){
+			delay(5);
+		}
+	}
+	pass = pass && flipped && !pix.update_blink(50); // No time passed: same phase
+	pix.set_blink_phase(true);
+
+	// Mirrored and upside down, the attributes stay with their positions
+	for(uint8_t mode = PIX_MIRROR_X; mode <= PIX_ROTATE_180; mode++){
+		pix.set_orientation(mode);
+		pix.show();
+		settle(chain);
+		chain.get_columns(cols);
+		attr_columns(normal, attrs, true, expect, 30);
+		orient_columns(expect, oriented, 30, mode);
+		pass = pass && memcmp(cols, oriented, 30) == 0;
+	}
+	pix.set_blink_phase(false);
+	pass = pass && pix.show_changes();
+	settle(chain);
+	chain.get_columns(cols);
+	attr_columns(normal, attrs, false, expect, 30);
+	orient_columns(expect, oriented, 30, PIX_ROTATE_180);
+	pass = pass && memcmp(cols, oriented, 30) == 0;
+	pix.set_orientation(PIX_NORMAL);
+
+	pix.clear_attributes();
+	pix.show();
+	settle(chain);
+	chain.get_columns(cols);
+	pass = pass && memcmp(cols, normal, 30) == 0 && pix.get_attribute(1) == 0;
+
+	// PixieFixed falls back to Pixie::encode() with attributes set
+	if(type == PRO){
+		PixieFixed<3, PRO> fixed(CLK_PIN, DATA_PIN);
+		fixed.begin(FULL_SPEED);
+		fixed.write((char*)"Ab1:5 ");
+		for(uint8_t i = 0; i < 6; i++){
+			fixed.set_attribute(i, attrs[i]);
+		}
+		fixed.show();
+		settle(chain);
+		chain.get_columns(cols);
+		attr_columns(normal, attrs, true, expect, 30);
+		pass = pass && memcmp(cols, expect, 30) == 0;
+	}
+	result(name, pass, chain);
+}
+
+static void check_widgets(uint16_t fw, uint8_t type, const char* name){
+	PixieChain chain(6, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(6, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	PixieClock clock(pix, 0);
+	PixieCounter counter(pix, 8, 4);
+	bool pass = clock.set(12, 34, 56) == 8 && counter.set(7) == 4;
+	pass = pass && pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:34:56   7", 0);
+
+	// One digit, one module: a change outside it isn't sent
+	pass = pass && clock.set(12, 34, 57) == 1;
+	pix.write_byte(0x7F, 0); // Module 0, not marked
+	pass = pass && pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:34:57   7", 0);
+	pix.write('1', 0);
+	pass = pass && clock.set(12, 34, 57) == 0 && !pix.show_changes();
+	pass = pass && clock.set(12, 35, 0) == 3 && counter.set(8) == 1;
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "12:35:00   8", 0);
+	pass = pass && clock.set((uint32_t)(23*3600L + 59*60 + 59)) == 6; // Not the colons
+	pass = pass && counter.set(-42) == 3 && counter.get() == -42;
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "23:59:59 -42", 0);
+	counter.set(123456); // Odometer
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "23:59:593456", 0);
+
+	PixieCounter zeros(pix, 8, 4, '0');
+	pass = pass && zeros.set(-5) == 4;
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "-005", 8);
+	zeros.set(42);
+	pass = pass && zeros.set(42) == 0;
+	zeros.invalidate();
+	pass = pass && zeros.set(42) == 4;
+	pix.show_changes();
+	settle(chain);
+	pass = pass && expect_text(chain, "0042", 8);
+
+	// A digit rolls while the rest of the chain is drawn on
+	PixieTransition trans(pix);
+	zeros.animate(trans, PIX_ROLL_UP, 200);
+	pass = pass && zeros.set(43) == 1 && !zeros.done();
+	uint8_t shows = 0;
+	while(!zeros.done()){
+		if(shows == 2){
+			clock.set(13, 0, 0);
+		}
+		if(zeros.update()){
+			pix.show_changes();
+			settle(chain);
+			shows++;
+			pass = pass && expect_text(chain, "004", 8);
+			if(shows > 2){
+				pass = pass && expect_text(chain, "13:00:00", 0);
+			}
+		}
+		delay(5);
+	}
+	pix.show_changes();
+	settle(chain);
+	pass = pass && shows >= 3 && expect_text(chain, "13:00:000043", 0);
+	result(name, pass, chain);
+}
+
+static void check_numbers(const char* name){
+	PixieChain chain(12, PIX_FW_130), ref_chain(12, PIX_FW_130);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO_CRC);
+	pix.begin(FULL_SPEED);
+	host_attach(&ref_chain, CLK_PIN, DATA_PIN);
+	Pixie ref(12, CLK_PIN, DATA_PIN, PRO_CRC);
+	ref.begin(FULL_SPEED);
+	char buf[48];
+	bool pass = true;
+
+	int32_t ints[] = {0, 7, -7, 42, 99, 100, -100, 9999, 10000, -10001, 32767, -32768, 99999999, 123456789, 2147483647, INT32_MIN};
+	for(uint8_t i = 0; i < sizeof(ints)/sizeof(ints[0]); i++){
+		pix.clear();
+		ref.clear();
+		pix.write(ints[i], 1);
+		ltoa(ints[i], buf, 10);
+		ref.write(buf, 1);
+		pass = pass && same_image(pix, ref, chain, ref_chain) && pix.get_length(ints[i]) == strlen(buf);
+	}
+	uint16_t shorts[] = {0, 9, 10, 255, 1000, 65535};
+	for(uint8_t i = 0; i < 6; i++){
+		pix.clear();
+		ref.clear();
+		pix.print(shorts[i]);
+		pix.push(shorts[i]);
+		utoa(shorts[i], buf, 10);
+		ref.print(buf);
+		ref.push(buf);
+		pass = pass && same_image(pix, ref, chain, ref_chain);
+	}
+	pix.clear();
+	ref.clear();
+	pix.shift((uint32_t)4294967295UL);
+	ref.shift((char*)"4294967295");
+	pass = pass && same_image(pix, ref, chain, ref_chain) && pix.get_length((uint32_t)4294967295UL) == 10;
+
+	float floats[] = {0, 3.14159, -2.71828, 0.005, 99.995, 1234.5678, -0.24, 1e6, 0.0001};
+	for(uint8_t i = 0; i < sizeof(floats)/sizeof(floats[0]); i++){
+		for(uint8_t places = 0; places < 5; places++){
+			pix.clear();
+			ref.clear();
+			pix.write(floats[i], places);
+			sprintf(buf, "%.*f", places, floats[i]);
+			ref.write(buf);
+			pass = pass && same_image(pix, ref, chain, ref_chain) && pix.get_length(floats[i], places) == strlen(buf);
+		}
+	}
+	pix.clear();
+	ref.clear();
+	pix.write(NAN, 2, 0);
+	pix.write(-INFINITY, 2, 4);
+	pix.write(1e12, 2, 9);
+	ref.write((char*)"nan -inf ovf");
+	pass = pass && same_image(pix, ref, chain, ref_chain);
+
+	PixieChain small(3, PIX_FW_130);
+	host_attach(&small, CLK_PIN, DATA_PIN);
+	Pixie fmt(3, CLK_PIN, DATA_PIN, PRO_CRC);
+	fmt.begin(FULL_SPEED);
+	fmt.set_number_format(6, '0');
+	fmt.write((int16_t)-42);
+	fmt.show();
+	settle(small);
+	pass = pass && expect_text(small, "-00042", 0);
+	fmt.clear();
+	fmt.set_number_format(3, ' ', PIX_ALIGN_LEFT);
+	fmt.write(1.5, 1, 0);
+	fmt.write((uint16_t)7, 4);
+	fmt.show();
+	settle(small);
+	pass = pass && expect_text(small, "1.5", 0) && expect_char(small, 4, '7') && expect_blank(small, 5, 6);
+	fmt.clear();
+	fmt.set_number_format(5, '0', PIX_ALIGN_LEFT); // Spaces, not "42000"
+	fmt.write((int16_t)42);
+	fmt.show();
+	settle(small);
+	pass = pass && expect_text(small, "42    ", 0);
+	fmt.clear();
+	fmt.set_number_format(6, '0');                 // Words aren't zero padded
+	double words[3] = {NAN, -INFINITY, 1e12};
+	const char* padded[3] = {"   nan", "  -inf", "   ovf"};
+	for(uint8_t i = 0; i < 3; i++){
+		fmt.write(words[i], 2, 0);
+		fmt.show();
+		settle(small);
+		pass = pass && expect_text(small, padded[i], 0);
+	}
+	fmt.clear();
+	fmt.set_number_format(3);
+	fmt.push((int32_t)5);
+	fmt.show();
+	settle(small);
+	pass = pass && expect_blank(small, 0, 5) && expect_char(small, 5, '5');
+	fmt.shift((int32_t)-1); // Pushes the 5 back off the right edge
+	fmt.show();
+	settle(small);
+	pass = pass && expect_text(small, " -1", 0) && expect_blank(small, 3, 6) && small.errors() == 0;
+	result(name, pass, chain);
+}
+
+// -----------------------------------------------------------------------------
+
+static uint8_t animation[4][5] = {
+	{0x01,0x01,0x01,0x01,0x01},
+	{0x00,0x01,0x01,0x01,0x03},
+	{0x00,0x00,0x01,0x01,0x07},
+	{0x00,0x00,0x00,0x01,0x0F}
+};
+
+// Same loop as examples/08_Speed_Test, for one simulated second
+static void speed_test(uint16_t fw, uint8_t type, uint8_t speed, uint8_t count){
+	PixieChain chain(count, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(count, CLK_PIN, DATA_PIN, type);
+	pix.begin(speed);
+	settle(chain);
+
+	uint32_t frames_start = chain.frames();
+	uint64_t bits_start   = chain.bits;
+	uint32_t t_start = millis();
+	uint32_t t_end   = t_start + 1000;
+	uint16_t fps = 0;
+	while(millis() < t_end){
+		fps++;
+		pix.clear();
+		pix.print(animation[fps%4]);
+		pix.show();
+	}
+	settle(chain);
+
+	const char* names[3] = {"LEGACY", "PRO", "PRO_CRC"};
+	if(type != LEGACY && speed > FULL_SPEED){
+		speed = FULL_SPEED; // Same as begin()
+	}
+	printf("  fw %u  %-7s  clk_us %2u  %2u modules  %4u FPS  %5u latched  %8llu bits  %4u errors\n",
+		fw, names[type], speed, count, fps,
+		chain.frames() - frames_start, (unsigned long long)(chain.bits - bits_start), chain.errors());
+}
+
+static void scroll_test(uint16_t fw, uint8_t type, uint8_t count){
+	PixieChain chain(count, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(count, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	settle(chain);
+
+	uint64_t t_start = host_time_ns();
+	uint64_t bits_start = chain.bits;
+	pix.scroll_message((char*)"Hello, from your new PIXIES!");
+	printf("  fw %u  %-6s  %2u modules  scroll_message(28 chars): %7.1f ms simulated, %8llu bits\n",
+		fw, type == PRO ? "PRO" : "LEGACY", count, (host_time_ns()-t_start)/1e6,
+		(unsigned long long)(chain.bits - bits_start));
+}
+
+// PixieScroller at a fixed rate, called from a loop that also does other work
+static void scroller_test(uint16_t fw, uint8_t type, uint8_t count, bool instant, const PixieFont* font = NULL){
+	PixieChain chain(count, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(count, CLK_PIN, DATA_PIN, type);
+	pix.begin(FULL_SPEED);
+	settle(chain);
+
+	PixieScroller scroller(pix);
+	uint64_t t_start = host_time_ns();
+	uint32_t loops = 0;
+	uint32_t shows = 0;
+	if(font != NULL){
+		scroller.begin((char*)"Hello, from your new PIXIES!", *font, 50);
+	}
+	else{
+		scroller.begin((char*)"Hello, from your new PIXIES!", 50, instant);
+	}
+	while(!scroller.done()){
+		shows += scroller.update();
+		loops++;
+		delayMicroseconds(100); // The rest of the sketch
+	}
+	settle(chain);
+	bool blank = expect_blank(chain, 0, count*2);
+	printf("  fw %u  %-6s  %2u modules  PixieScroller(28 chars, 50 px/s%s): %7.1f ms simulated, %5u shows, %6u loop passes%s\n",
+		fw, type == PRO ? "PRO" : "LEGACY", count, font ? ", proportional" : (instant ? ", instant" : ""), (host_time_ns()-t_start)/1e6,
+		shows, loops, blank ? "" : "  NOT BLANK");
+	if(!blank || chain.errors() != 0){
+		failures++;
+	}
+}
+
+// Host CPU time of each primitive against the same shape drawn with set_pix(),
+// on a 12-module (24 display, 120 column) chain. Only the ratio carries over to a
+// microcontroller, absolute numbers are for this machine.
+static double time_ns(void (*draw)(Pixie&), Pixie& pix){
+	const uint32_t runs = 20000;
+	double best = 1e12;
+	for(uint8_t rep = 0; rep < 7; rep++){ // Best of 7, to ride out scheduler noise
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < runs; i++){
+			draw(pix);
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / runs;
+		if(ns < best){
+			best = ns;
+		}
+	}
+	return best;
+}
+
+static void prim_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN); // old_draw_line() delays, which advances any chain still attached
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	struct { const char* name; void (*fast)(Pixie&); void (*slow)(Pixie&); } rows[] = {
+		{"fill_rect(0,0,120,7)",
+			[](Pixie& p){ p.fill_rect(0, 0, 120, 7); },
+			[](Pixie& p){ for(int16_t x = 0; x < 120; x++){ for(int16_t y = 0; y < 7; y++){ p.set_pix(x, y, 1); } } }},
+		{"draw_rect(0,0,120,7)",
+			[](Pixie& p){ p.draw_rect(0, 0, 120, 7); },
+			[](Pixie& p){ for(int16_t x = 0; x < 120; x++){ p.set_pix(x, 0, 1); p.set_pix(x, 6, 1); }
+			              for(int16_t y = 0; y < 7; y++){ p.set_pix(0, y, 1); p.set_pix(119, y, 1); } }},
+		{"draw_hline(0,3,120)",
+			[](Pixie& p){ p.draw_hline(0, 3, 120); },
+			[](Pixie& p){ for(int16_t x = 0; x < 120; x++){ p.set_pix(x, 3, 1); } }},
+		{"draw_vline() x120",
+			[](Pixie& p){ for(int16_t x = 0; x < 120; x++){ p.draw_vline(x, 0, 7); } },
+			[](Pixie& p){ for(int16_t x = 0; x < 120; x++){ for(int16_t y = 0; y < 7; y++){ p.set_pix(x, y, 1); } } }},
+		{"draw_line(0,0,119,6)",
+			[](Pixie& p){ p.draw_line(0, 0, 119, 6); },
+			[](Pixie& p){ old_draw_line(p, 0, 0, 119, 6); }},
+		{"draw_line(0,0,6,6) x17",
+			[](Pixie& p){ for(int16_t x = 0; x < 119; x += 7){ p.draw_line(x, 0, x+6, 6); } },
+			[](Pixie& p){ for(int16_t x = 0; x < 119; x += 7){ old_draw_line(p, x, 0, x+6, 6); } }},
+		{"draw_circle(r=3) x17",
+			[](Pixie& p){ for(int16_t x = 3; x < 120; x += 7){ p.draw_circle(x, 3, 3); } },
+			[](Pixie& p){ for(int16_t x = 3; x < 120; x += 7){ circle_set_pix(p, x, 3, 3, false); } }},
+		{"fill_circle(r=3) x17",
+			[](Pixie& p){ for(int16_t x = 3; x < 120; x += 7){ p.fill_circle(x, 3, 3); } },
+			[](Pixie& p){ for(int16_t x = 3; x < 120; x += 7){ circle_set_pix(p, x, 3, 3, true); } }},
+	};
+	printf("  %-24s %12s %12s %8s\n", "primitive", "span (ns)", "set_pix (ns)", "speedup");
+	for(uint8_t i = 0; i < sizeof(rows)/sizeof(rows[0]); i++){
+		double fast = time_ns(rows[i].fast, pix);
+		double slow = time_ns(rows[i].slow, pix);
+		printf("  %-24s %12.0f %12.0f %7.1fx\n", rows[i].name, fast, slow, slow/fast);
+	}
+}
+
+// The number overloads before the formatting engine: a string from itoa() or
+// sprintf(), written again by write(char*). get_length() divided in a loop.
+static int16_t  num16[8] = {0, 7, -42, 999, -1234, 20000, 32767, -32768};
+static int32_t  num32[8] = {0, 86400, -100000, 1234567, 99999999, -123456789, 2147483647, 65536};
+static float    numf[8]  = {0, 3.14159, -2.5, 98.6, 1013.25, -40.125, 12345.678, 0.05};
+
+static uint8_t old_get_length(int32_t input){
+	if(input == 0){
+		return 1;
+	}
+	uint8_t places = 0;
+	if(input < 0){
+		places++;
+	}
+	while(abs(int32_t(input)) >= 1){
+		input /= 10;
+		places++;
+	}
+	return places;
+}
+
+static volatile uint8_t length_sink;
+
+static void num_bench(){
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	struct { const char* name; void (*fast)(Pixie&); void (*slow)(Pixie&); } rows[] = {
+		{"write(int16_t) x8",
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ p.write(num16[i]); } },
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ char b[48]; itoa(num16[i], b, 10); p.write(b); } }},
+		{"write(int32_t) x8",
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ p.write(num32[i]); } },
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ char b[48]; ltoa(num32[i], b, 10); p.write(b); } }},
+		{"write(float, 2) x8",
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ p.write(numf[i], 2); } },
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ char b[48]; sprintf(b, "%.*f", 2, numf[i]); p.write(b); } }},
+		{"push(int16_t) x8",
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ p.push(num16[i]); } },
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ char b[48]; itoa(num16[i], b, 10); p.push(b); } }},
+		{"get_length(int32_t) x8",
+			[](Pixie& p){ for(uint8_t i = 0; i < 8; i++){ length_sink = p.get_length(num32[i]); } },
+			[](Pixie&){ for(uint8_t i = 0; i < 8; i++){ length_sink = old_get_length(num32[i]); } }},
+	};
+	printf("  %-24s %12s %12s %8s\n", "call", "engine (ns)", "before (ns)", "speedup");
+	for(uint8_t i = 0; i < sizeof(rows)/sizeof(rows[0]); i++){
+		double fast = time_ns(rows[i].fast, pix);
+		double slow = time_ns(rows[i].slow, pix);
+		printf("  %-24s %12.0f %12.0f %7.1fx\n", rows[i].name, fast, slow, slow/fast);
+	}
+}
+
+// A static label drawn from a string at run time, and from its PIXIE_TEXT()
+// columns, on 12 modules
+static char fps_text[] = "FPS!";
+static char long_text[] = LONG_TEXT;
+static void text_bench(){
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	pix.set_glyphs(PIX_GLYPHS_EXT);
+	pix.canvas(sizeof(LONG_LABEL));
+	struct { const char* name; void (*fast)(Pixie&); void (*slow)(Pixie&); } rows[] = {
+		{"write(\"FPS!\")",
+			[](Pixie& p){ p.write(FPS_LABEL); },
+			[](Pixie& p){ p.write(fps_text); }},
+		{"draw_text(LONG_TEXT, 0)",
+			[](Pixie& p){ p.draw_text(LONG_LABEL, 0); },
+			[](Pixie& p){ p.draw_text(long_text, 0); }},
+	};
+	printf("  %-24s %12s %12s %8s\n", "label", "PIXIE_TEXT", "string (ns)", "speedup");
+	for(uint8_t i = 0; i < sizeof(rows)/sizeof(rows[0]); i++){
+		double fast = time_ns(rows[i].fast, pix);
+		double slow = time_ns(rows[i].slow, pix);
+		printf("  %-24s %12.0f %12.0f %7.1fx\n", rows[i].name, fast, slow, slow/fast);
+	}
+	printf("  flash: %u bytes of columns for %u characters, %u bytes as a string\n",
+		(unsigned)sizeof(LONG_LABEL), (unsigned)(sizeof(LONG_LABEL)/5), (unsigned)sizeof(long_text));
+}
+
+// A one second fade of 12 modules, at whatever rate the chain can be driven.
+// brightness() sends its own frame before each show(). set_brightness() and
+// PixieFader ride along with the frame show() sends anyway.
+static void fade_bench(uint16_t fw, uint8_t type, uint8_t speed){
+	const char* names[3] = {"LEGACY", "PRO", "PRO_CRC"};
+	const char* ways[3]  = {"brightness() + show()", "write_brightness() x12 + show()", "PixieFader + show()"};
+	for(uint8_t way = 0; way < 3; way++){
+		if(way == 1 && type == LEGACY){
+			continue; // LEGACY write_brightness() sends nothing by itself
+		}
+		PixieChain chain(12, fw);
+		host_attach(&chain, CLK_PIN, DATA_PIN);
+		Pixie pix(12, CLK_PIN, DATA_PIN, type);
+		pix.begin(speed);
+		pix.brightness(0);
+		settle(chain);
+		PixieFader fader(pix);
+
+		uint32_t frames = chain.frames();
+		uint32_t t_start = millis();
+		uint16_t steps = 0;
+		if(way == 2){
+			fader.fade_to(127, 1000, PIX_EASE_LINEAR);
+		}
+		while(millis() - t_start < 1000){
+			uint8_t level = (millis() - t_start) * 127 / 1000;
+			if(way == 0){
+				pix.brightness(level);
+			}
+			else if(way == 1){
+				for(uint8_t m = 0; m < 12; m++){
+					pix.write_brightness(level, m);
+				}
+			}
+			else{
+				fader.update();
+			}
+			pix.clear();
+			pix.print(animation[steps%4]);
+			pix.show();
+			steps++;
+		}
+		settle(chain);
+		printf("  fw %u  %-7s  %-32s %4u steps/s  %5u frames\n",
+			fw, names[type], ways[way], steps, chain.frames() - frames);
+	}
+}
+
+// Gray levels a chain can hold without flicker: 2^bits levels take (2^bits - 1)
+// frame times per cycle, and the frame time grows with the chain
+static void gray_bench(){
+	struct { uint16_t fw; uint8_t type; uint8_t speed; const char* name; } links[] = {
+		{PIX_FW_110, LEGACY,  FULL_SPEED, "LEGACY fw1.1.0 FULL_SPEED"},
+		{PIX_FW_120, PRO,     FULL_SPEED, "PRO fw1.2.0 FULL_SPEED"},
+		{PIX_FW_140, PRO_CRC, USI_SPEED,  "PRO_CRC fw1.4.0 USI_SPEED"},
+	};
+	uint8_t counts[5] = {1, 2, 3, 6, 12};
+	printf("  %-26s %7s %9s %12s %12s\n", "transport", "modules", "frame us", "levels@50Hz", "levels@100Hz");
+	for(uint8_t l = 0; l < 3; l++){
+		for(uint8_t c = 0; c < 5; c++){
+			PixieChain chain(counts[c], links[l].fw);
+			host_attach(&chain, CLK_PIN, DATA_PIN);
+			Pixie pix(counts[c], CLK_PIN, DATA_PIN, links[l].type);
+			pix.begin(links[l].speed);
+			settle(chain);
+			uint32_t t0 = micros();
+			pix.show();
+			uint32_t frame = micros() - t0;
+			uint16_t levels[2] = {1, 1};
+			uint32_t periods[2] = {20000, 10000};
+			for(uint8_t h = 0; h < 2; h++){
+				while(levels[h] < 256 && (uint32_t)(levels[h]*2 - 1) * frame <= periods[h]){
+					levels[h] *= 2;
+				}
+			}
+			char cells[2][8];
+			for(uint8_t h = 0; h < 2; h++){ // Less than 2 levels: can't even refresh that often
+				snprintf(cells[h], sizeof(cells[h]), levels[h] < 2 ? "-" : "%u", levels[h]);
+			}
+			printf("  %-26s %7u %9u %12s %12s\n", links[l].name, counts[c], frame, cells[0], cells[1]);
+		}
+	}
+}
+
+// The spinner and the ball played for 2 simulated seconds on 12 modules by a
+// loop that sends every pass: show() every time, against show_changes(),
+// which sends only when the player moved on.
+static void player_bench(uint16_t fw, uint8_t type, uint8_t speed){
+	const char* names[3] = {"LEGACY", "PRO", "PRO_CRC"};
+	struct { const char* what; const PixieAnimation* anim; } rows[2] = {
+		{"spinner", &PIX_ANIM_SPIN},
+		{"ball",    &PIX_ANIM_BALL},
+	};
+	for(uint8_t r = 0; r < 2; r++){
+		uint64_t bits[2];
+		uint32_t sends[2];
+		uint32_t frames[2];
+		for(uint8_t way = 0; way < 2; way++){
+			PixieChain chain(12, fw);
+			host_attach(&chain, CLK_PIN, DATA_PIN);
+			Pixie pix(12, CLK_PIN, DATA_PIN, type);
+			pix.begin(speed);
+			settle(chain);
+			PixiePlayer player(pix);
+			player.begin(*rows[r].anim, 0);
+			pix.show();
+			uint64_t bits_start = chain.bits;
+			uint32_t t_start = millis();
+			sends[way] = frames[way] = 0;
+			while(millis() - t_start < 2000){
+				frames[way] += player.update();
+				if(way == 0){
+					pix.show();
+					sends[way]++;
+				}
+				else{
+					sends[way] += pix.show_changes();
+				}
+				delay(1);
+			}
+			settle(chain);
+			bits[way] = chain.bits - bits_start;
+		}
+		printf("  fw %u  %-7s  %-7s  show(): %4u frames, %4u sends %8llu bits   show_changes(): %4u frames, %4u sends %8llu bits\n",
+			fw, names[type], rows[r].what, frames[0], sends[0], (unsigned long long)bits[0],
+			frames[1], sends[1], (unsigned long long)bits[1]);
+	}
+}
+
+// The clock sign on 12 modules: a time field, an icon and a ticker. Each
+// step scrolls the ticker a column and every 20th changes the time. Host CPU
+// time of the drawing before the send: everything rendered again, against
+// the layers composing the columns that changed.
+static void layers_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	char* news = (char*)"Stocks up, rain at 5pm, bridge closed  ";
+	uint16_t news_w = pix.text_length(news) * 5;
+	static uint32_t step = 0;
+	static char* text = news;
+	static uint16_t text_w = news_w;
+	double full = time_ns([](Pixie& d){
+		step++;
+		d.clear();
+		int16_t x = 30 - (int16_t)(step % text_w);
+		d.draw_text(text, x);
+		d.draw_text(text, x + text_w);
+		d.fill_rect(0, 0, 30, 7, 0); // The ticker only shows right of the icon
+		d.write(step / 20 % 2 ? (char*)"12:34" : (char*)"12:35", 0);
+		d.write(0x08, 0x1C, 0x3E, 0x1C, 0x08, 5);
+	}, pix);
+	PixieLayers layers(pix);
+	PixieLayer clock(pix, 0, 25);
+	PixieLayer icon(pix, 25, 5);
+	PixieLayer ticker(pix, 30, 90, news_w);
+	clock.draw_text((char*)"12:34", 0);
+	icon.put_column(0, 0x08);
+	icon.put_column(1, 0x1C);
+	icon.put_column(2, 0x3E);
+	icon.put_column(3, 0x1C);
+	icon.put_column(4, 0x08);
+	ticker.draw_text(news, 0);
+	layers.add(clock);
+	layers.add(icon);
+	layers.add(ticker);
+	layers.compose();
+	static PixieLayer* t = &ticker;
+	static PixieLayer* c = &clock;
+	static PixieLayers* l = &layers;
+	step = 0;
+	double composed = time_ns([](Pixie&){
+		step++;
+		t->scroll(1);
+		if(step % 20 == 0){
+			c->draw_text(step / 20 % 2 ? (char*)"12:34" : (char*)"12:35", 0);
+		}
+		l->compose();
+	}, pix);
+	printf("  re-render all: %7.0f ns/step   layers: %7.0f ns/step (%.1fx)\n", full, composed, full / composed);
+}
+
+// Host CPU time of one PixieTransition step, for each effect on 6 and 12
+// modules: each step is computed for every visible column, so it should
+// double with the chain.
+static void transition_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	const char* names[6] = {"PIX_ROLL_UP", "PIX_ROLL_DOWN", "PIX_WIPE_RIGHT", "PIX_WIPE_LEFT", "PIX_DISSOLVE", "PIX_FLIP"};
+	for(uint8_t effect = PIX_ROLL_UP; effect <= PIX_FLIP; effect++){
+		double ns[2];
+		for(uint8_t size = 0; size < 2; size++){
+			uint8_t count = size ? 12 : 6;
+			Pixie pix(count, CLK_PIN, DATA_PIN, PRO);
+			PixieTransition trans(pix);
+			double best = 1e12;
+			for(uint8_t rep = 0; rep < 7; rep++){
+				pix.clear();
+				pix.write((char*)"12:34:56 Mon", 0);
+				trans.capture();
+				pix.write((char*)"12:35:07 Tue", 0);
+				trans.begin(effect, 2000);
+				uint32_t steps = 0;
+				double total = 0;
+				while(!trans.done()){
+					auto t0 = std::chrono::steady_clock::now();
+					bool changed = trans.update();
+					auto t1 = std::chrono::steady_clock::now();
+					if(changed){
+						total += std::chrono::duration<double, std::nano>(t1 - t0).count();
+						steps++;
+					}
+					delay(1);
+				}
+				if(total / steps < best){
+					best = total / steps;
+				}
+			}
+			ns[size] = best;
+		}
+		printf("  %-15s  6 modules: %6.0f ns/step   12 modules: %6.0f ns/step\n", names[effect], ns[0], ns[1]);
+	}
+}
+
+// RAM and host CPU time of show() for Pixie and PixieFixed on 12 modules. The
+// chain is detached, so this is encode(), the check bits and the pin loop.
+template<class T> static double show_ns(T& pix){
+	const uint32_t runs = 2000;
+	double best = 1e12;
+	for(uint8_t rep = 0; rep < 7; rep++){
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < runs; i++){
+			pix.show();
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / runs;
+		if(ns < best){
+			best = ns;
+		}
+	}
+	return best;
+}
+
+// Host CPU time of show() on 12 modules without attributes and with every
+// position inverted and underlined, then of a blinking colon: the phase flipped
+// and show_changes(), against writing the colon or a space and show()
+static void attributes_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	pix.write((char*)"Attributes!!");
+	double plain = show_ns(pix);
+	for(uint8_t i = 0; i < 24; i++){
+		pix.set_attribute(i, PIX_INVERT | PIX_UNDERLINE);
+	}
+	double all = show_ns(pix);
+	printf("  show():  no attributes %6.0f ns   24 positions inverted + underlined %6.0f ns\n", plain, all);
+
+	pix.clear_attributes();
+	pix.write((char*)"    12:34:56");
+	pix.set_attribute(6, PIX_BLINK);
+	pix.set_attribute(9, PIX_BLINK);
+	static uint32_t step = 0;
+	double redraw = time_ns([](Pixie& d){
+		step++;
+		d.write(step % 2 ? ':' : ' ', 6);
+		d.write(step % 2 ? ':' : ' ', 9);
+		d.show();
+	}, pix);
+	double phase = time_ns([](Pixie& d){
+		step++;
+		d.set_blink_phase(step % 2);
+		d.show_changes();
+	}, pix);
+	printf("  blinking colons: redraw + show() %6.0f ns   set_blink_phase() + show_changes() %6.0f ns\n", redraw, phase);
+}
+
+// A clock updated once a second for a day: positions drawn and modules
+// re-encoded by PixieClock against writing the whole time, and the host CPU
+// time of an update with show_changes() against write() and show()
+static void widgets_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	uint32_t positions = 0;
+	uint32_t modules   = 0;
+	char last[9] = "";
+	for(uint32_t t = 0; t < 86400; t++){
+		char now[9];
+		snprintf(now, sizeof(now), "%02u:%02u:%02u", (unsigned)(t / 3600), (unsigned)(t / 60 % 60), (unsigned)(t % 60));
+		int8_t first = -1;
+		int8_t end   = 0;
+		for(uint8_t i = 0; i < 8; i++){
+			if(now[i] != last[i]){
+				positions++;
+				if(first < 0){
+					first = i;
+				}
+				end = i;
+			}
+		}
+		modules += end / 2 - first / 2 + 1; // mark_dirty() keeps one range
+		memcpy(last, now, 9);
+	}
+	printf("  HH:MM:SS for 24 h: write() %6u positions, %6u modules   PixieClock %6u positions (%.2f/s), %6u modules (%.2f/s)\n",
+		86400u * 8, 86400u * 4, (unsigned)positions, positions / 86400.0, (unsigned)modules, modules / 86400.0);
+
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	static PixieClock* clock = new PixieClock(pix, 2);
+	static uint32_t t = 0;
+	double whole = time_ns([](Pixie& d){
+		t++;
+		char text[9];
+		snprintf(text, sizeof(text), "%02u:%02u:%02u", (unsigned)(t / 3600 % 24), (unsigned)(t / 60 % 60), (unsigned)(t % 60));
+		d.write(text, 2);
+		d.show();
+	}, pix);
+	double widget = time_ns([](Pixie& d){
+		t++;
+		clock->set(t);
+		d.show_changes();
+	}, pix);
+	printf("  12 modules, per update: write() + show() %6.0f ns   PixieClock::set() + show_changes() %6.0f ns\n", whole, widget);
+	delete clock;
+}
+
+// Host CPU time of show() on 12 modules in each orientation: the encoder's
+// table lookup and reversed read are the only difference
+static void orientation_bench(){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	const char* names[4] = {"PIX_NORMAL", "PIX_MIRROR_X", "PIX_MIRROR_Y", "PIX_ROTATE_180"};
+	Pixie pix(12, CLK_PIN, DATA_PIN, PRO);
+	pix.write((char*)"Orientation!");
+	for(uint8_t mode = PIX_NORMAL; mode <= PIX_ROTATE_180; mode++){
+		pix.set_orientation(mode);
+		printf("  %-15s show() %6.0f ns\n", names[mode], show_ns(pix));
+	}
+}
+
+template<uint8_t TYPE> static void fixed_bench(const char* label){
+	host_attach(NULL, CLK_PIN, DATA_PIN);
+	Pixie pix(12, CLK_PIN, DATA_PIN, TYPE);
+	PixieFixed<12, TYPE> fixed(CLK_PIN, DATA_PIN);
+	uint16_t heap = 12*10 + PixieFixed<12, TYPE>::BYTES + 12*2; // frame + wire layout + attributes
+	double lo[2] = {1e12, 1e12};
+	double hi[2] = {0, 0};
+	for(uint8_t run = 0; run < 5; run++){ // Interleaved, so drift hits both alike
+		double ns[2] = {show_ns(pix), show_ns(fixed)};
+		for(uint8_t i = 0; i < 2; i++){
+			if(ns[i] < lo[i]){
+				lo[i] = ns[i];
+			}
+			if(ns[i] > hi[i]){
+				hi[i] = ns[i];
+			}
+		}
+	}
+	printf("  %-8s  Pixie: %3u B object + %3u B heap, show() %6.0f-%-6.0f ns   PixieFixed: %3u B static, show() %6.0f-%-6.0f ns\n",
+		label, (unsigned)sizeof(pix), heap, lo[0], hi[0], (unsigned)sizeof(fixed), lo[1], hi[1]);
+}
+
+// -----------------------------------------------------------------------------
+
+// Sends random images through a corrupted wire and counts packets the module
+// accepted although what it did differs from what was sent (a lost pulse at
+// the very end of a packet can leave it intact). Returns that count.
+static uint32_t fault_test(uint16_t fw, uint8_t type, uint8_t flips, bool slip, uint32_t trials){
+	PixieChain chain(1, fw);
+	host_attach(&chain, CLK_PIN, DATA_PIN);
+	Pixie pix(1, CLK_PIN, DATA_PIN, type);
+	pix.begin();
+	settle(chain);
+
+	uint32_t rng = 0x2545F491;
+	PixieModule& m = chain.module(0);
+	uint32_t undetected = 0;
+	for(uint32_t t = 0; t < trials; t++){
+		uint8_t c[10];
+		for(uint8_t i = 0; i < 10; i++){
+			rng ^= rng << 13;
+			rng ^= rng >> 17;
+			rng ^= rng << 5;
+			c[i] = rng & 0x7F;
+		}
+		pix.write(c[0], c[1], c[2], c[3], c[4], 0);
+		pix.write(c[5], c[6], c[7], c[8], c[9], 1);
+
+		chain.inject_faults(0, false); // Clean copy first, as the reference
+		pix.show();
+		chain.advance(host_time_ns());
+		uint8_t reference[10];
+		memcpy(reference, m.image, 10);
+
+		chain.inject_faults(flips, slip, t+1);
+		uint32_t rejected = m.check_errors;
+		uint32_t frames   = m.frames;
+		pix.show();
+		chain.advance(host_time_ns());
+		bool intact = (m.frames == frames+1) && memcmp(m.image, reference, 10) == 0 && m.pwm == 127;
+		if(m.check_errors == rejected && !intact){
+			undetected++;
+		}
+	}
+	return undetected;
+}
+
+int main(int argc, char** argv){
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "--pin-ns") == 0 && i+1 < argc){
+			host_set_pin_cost(atoi(argv[++i]));
+		}
+		else if(strcmp(argv[i], "--verbose") == 0){
+			verbose = true;
+		}
+	}
+
+	printf("Protocol checks\n");
+	check_legacy(PIX_FW_100, LEGACY_SPEED, "legacy fw1.0.0: write() + print()");
+	check_legacy(PIX_FW_110, FULL_SPEED,   "legacy fw1.1.0: write() + print()");
+	check_pro(PIX_FW_120, PRO,     FULL_SPEED, "pro fw1.2.0");
+	check_pro(PIX_FW_130, PRO_CRC, FULL_SPEED, "pro_crc fw1.3.0");
+	check_pro(PIX_FW_140, PRO_CRC, USI_SPEED,  "pro_crc fw1.4.0 USI");
+	check_pro(PIX_FW_120, PRO,     USI_SPEED,  "pro fw1.2.0: USI_SPEED falls back to FULL_SPEED");
+	check_drawing(PIX_FW_110, LEGACY, FULL_SPEED, "legacy fw1.1.0: set_pix() + push() + shift()");
+	check_drawing(PIX_FW_130, PRO_CRC, FULL_SPEED, "pro_crc fw1.3.0: set_pix() + push() + shift()");
+	check_canvas(PIX_FW_110, LEGACY, "legacy fw1.1.0: canvas() + viewport");
+	check_blit(PIX_FW_110, LEGACY, "legacy fw1.1.0: blit()");
+	check_blit(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: blit()");
+	check_primitives("pro_crc fw1.3.0: span primitives match per-pixel drawing");
+	check_canvas(PIX_FW_120, PRO,    "pro fw1.2.0: canvas() + viewport");
+	check_prop_font(PIX_FW_110, LEGACY, "legacy fw1.1.0: proportional font + kerning");
+	check_prop_font(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: proportional font + kerning");
+	check_assets(PIX_FW_110, LEGACY, "legacy fw1.1.0: packed PROGMEM assets");
+	check_assets(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: packed PROGMEM assets");
+	check_utf8(PIX_FW_110, LEGACY, "legacy fw1.1.0: UTF-8 text + extended glyphs");
+	check_utf8(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: UTF-8 text + extended glyphs");
+	check_numbers("pro_crc fw1.3.0: number formatting matches itoa()/sprintf()");
+	check_print(PIX_FW_110, LEGACY, "legacy fw1.1.0: PixiePrint");
+	check_print(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: PixiePrint");
+	check_fixed<LEGACY>(PIX_FW_110, "legacy fw1.1.0: PixieFixed<3, LEGACY> matches Pixie");
+	check_fixed<PRO>(PIX_FW_120, "pro fw1.2.0: PixieFixed<3, PRO> matches Pixie");
+	check_fixed<PRO_CRC>(PIX_FW_130, "pro_crc fw1.3.0: PixieFixed<3, PRO_CRC> matches Pixie");
+	check_text(PIX_FW_110, LEGACY, "legacy fw1.1.0: PIXIE_TEXT() matches run-time text");
+	check_text(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: PIXIE_TEXT() matches run-time text");
+	check_brightness(PIX_FW_110, LEGACY, "legacy fw1.1.0: brightness map + PixieFader");
+	check_brightness(PIX_FW_120, PRO, "pro fw1.2.0: brightness map + PixieFader");
+	check_brightness(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: brightness map + PixieFader");
+	check_gray(PIX_FW_140, PRO_CRC, USI_SPEED, 2, "pro_crc fw1.4.0 USI: PixieGray 4 levels");
+	check_gray(PIX_FW_140, PRO_CRC, USI_SPEED, 4, "pro_crc fw1.4.0 USI: PixieGray 16 levels");
+	check_gray(PIX_FW_110, LEGACY, FULL_SPEED, 3, "legacy fw1.1.0: PixieGray 8 levels");
+	check_show_changes(PIX_FW_110, LEGACY, "legacy fw1.1.0: show_changes() sends only marked modules");
+	check_show_changes(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: show_changes() sends only marked modules");
+	check_player(PIX_FW_110, LEGACY, "legacy fw1.1.0: PixiePlayer + show_changes()");
+	check_player(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: PixiePlayer + show_changes()");
+	check_layers(PIX_FW_110, LEGACY, "legacy fw1.1.0: PixieLayers");
+	check_layers(PIX_FW_120, PRO, "pro fw1.2.0: PixieLayers");
+	check_transition(PIX_FW_110, LEGACY, "legacy fw1.1.0: PixieTransition");
+	check_transition(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: PixieTransition");
+	check_orientation(PIX_FW_110, LEGACY, "legacy fw1.1.0: orientation modes");
+	check_orientation(PIX_FW_120, PRO, "pro fw1.2.0: orientation modes + PixieFixed");
+	check_attributes(PIX_FW_110, LEGACY, "legacy fw1.1.0: position attributes");
+	check_attributes(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: position attributes");
+	check_attributes(PIX_FW_120, PRO, "pro fw1.2.0: position attributes + PixieFixed");
+	check_widgets(PIX_FW_110, LEGACY, "legacy fw1.1.0: PixieClock + PixieCounter");
+	check_widgets(PIX_FW_130, PRO_CRC, "pro_crc fw1.3.0: PixieClock + PixieCounter");
+
+	printf("\nSpeed test (1 simulated second)\n");
+	uint8_t counts[3] = {1, 6, 12};
+	for(uint8_t i = 0; i < 3; i++){
+		speed_test(PIX_FW_100, LEGACY, LEGACY_SPEED, counts[i]);
+		speed_test(PIX_FW_110, LEGACY, FULL_SPEED,   counts[i]);
+		speed_test(PIX_FW_120, PRO,    FULL_SPEED,   counts[i]);
+		speed_test(PIX_FW_140, PRO_CRC, USI_SPEED,   counts[i]);
+	}
+
+	printf("\nScrolling\n");
+	scroll_test(PIX_FW_110, LEGACY, 6);
+	scroll_test(PIX_FW_120, PRO,    6);
+	scroller_test(PIX_FW_110, LEGACY, 6, false);
+	scroller_test(PIX_FW_120, PRO,    6, false);
+	scroller_test(PIX_FW_120, PRO,   12, false);
+	scroller_test(PIX_FW_120, PRO,   12, true);
+	scroller_test(PIX_FW_120, PRO,    6, false, &PIX_FONT_PROP);
+	scroller_test(PIX_FW_120, PRO,   12, false, &PIX_FONT_PROP);
+
+	printf("\nPacked assets (flash bytes; the plain arrays are also SRAM on AVR)\n");
+	printf("  icon pack:  %4u bytes of uint8_t arrays -> %4u bytes PROGMEM (%s)\n",
+		222*5, (unsigned)sizeof(pix_icons_data), "PIX_PACK7");
+	printf("  font.h:     %4u bytes PROGMEM           -> %4u bytes PROGMEM (%s)\n",
+		(unsigned)sizeof(col), (unsigned)sizeof(pix_font_7bit_data), "PIX_PACK7");
+	printf("  3 bars:     %4u bytes                   -> %4u bytes PROGMEM (%s, with index)\n",
+		(unsigned)sizeof(bars), (unsigned)(sizeof(bars_data) + sizeof(bars_index)), "PIX_RLE");
+
+	printf("\nDrawing primitives (host CPU, 12 modules)\n");
+	prim_bench();
+
+	printf("\nNumber formatting (host CPU, 12 modules)\n");
+	num_bench();
+
+	printf("\nCompile-time labels (host CPU, 12 modules)\n");
+	text_bench();
+
+	printf("\nBrightness fade (1 simulated second, 12 modules)\n");
+	fade_bench(PIX_FW_110, LEGACY, FULL_SPEED);
+	fade_bench(PIX_FW_120, PRO, FULL_SPEED);
+
+	printf("\nGrayscale by bit planes (frame time simulated, levels that fit a 50/100 Hz cycle)\n");
+	gray_bench();
+
+	printf("\nDelta animations (2 simulated seconds, 12 modules)\n");
+	printf("  flash: spinner %u bytes (%u as arrays), ball %u bytes (%u as arrays)\n",
+		(unsigned)sizeof(pix_anim_spin_data), 24*5, (unsigned)sizeof(pix_anim_ball_data), 56*30);
+	player_bench(PIX_FW_110, LEGACY, FULL_SPEED);
+	player_bench(PIX_FW_120, PRO, FULL_SPEED);
+
+	printf("\nLayers (host, 12 modules, no chain attached)\n");
+	layers_bench();
+
+	printf("\nTransitions (host, no chain attached)\n");
+	transition_bench();
+
+	printf("\nOrientation (host, 12 modules, no chain attached)\n");
+	orientation_bench();
+
+	printf("\nAttributes (host, 12 modules, no chain attached)\n");
+	attributes_bench();
+
+	printf("\nCounter and clock widgets (no chain attached)\n");
+	widgets_bench();
+
+	printf("\nPixieFixed (host, 12 modules, no chain attached, show() range of 5 runs)\n");
+	fixed_bench<LEGACY>("LEGACY");
+	fixed_bench<PRO_CRC>("PRO_CRC");
+
+	printf("\nFault injection (1 module, %u random packets per row, undetected errors)\n", 20000);
+	printf("  %-18s %-22s %-22s\n", "corruption", "PRO (parity, fw1.2.0)", "PRO_CRC (CRC-8, fw1.3.0)");
+	uint8_t flips[7] = {1, 2, 3, 4, 5, 6, 8};
+	for(uint8_t i = 0; i < 8; i++){
+		char label[24];
+		uint8_t f = (i < 7) ? flips[i] : 0;
+		bool slip = (i == 7);
+		if(slip){
+			snprintf(label, sizeof(label), "1 lost CLK pulse");
+		}
+		else{
+			snprintf(label, sizeof(label), "%u bit flip%s", f, f == 1 ? "" : "s");
+		}
+		uint32_t parity = fault_test(PIX_FW_120, PRO,     f, slip, 20000);
+		uint32_t crc    = fault_test(PIX_FW_130, PRO_CRC, f, slip, 20000);
+		printf("  %-18s %6u (%6.3f%%)       %6u (%6.3f%%)\n", label, parity, parity/200.0, crc, crc/200.0);
+	}
+
+	printf("\n%u failure(s)\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+Packs an animation into a PROGMEM PixieAnimation header for PixiePlayer.
+
+Reads a header with a 2D array of frames, one row of columns per frame,
+like examples/07_Animation:
+
+    uint8_t animation[24][5] = {
+      {0x01,0x00,0x00,0x00,0x00},
+      ...
+    };
+
+The first frame is stored whole (the keyframe). After it comes one delta
+per frame: which columns change on the way to the next frame (a bitmap,
+one bit per column, least significant bit first), then the XOR of each
+changed column. The last delta leads back to the first frame, for
+looping. A frame that changes nothing costs only its bitmap.
+
+--ms N sets the time each frame stays up (default 100). --durations
+a,b,c,... gives each frame its own time instead.
+
+Usage:
+    python3 pack_animation.py [--ms 40] [--durations 500,40,40,...] frames.h PIX_ANIM_NAME > anim.h
+
+Released under the GPLv3 license, all text here must be included in any redistribution.
+"""
+
+import os
+import re
+import sys
+
+
+def read_frames(text):
+    body = re.search(r'\[\s*\d*\s*\]\s*\[\s*\d+\s*\]\s*(?:PROGMEM\s*)?=\s*\{(.*)\}\s*;', text, re.S)
+    if body is None:
+        sys.exit('No frame array found')
+    frames = []
+    for row in re.findall(r'\{([^{}]*)\}', body.group(1)):
+        frames.append([int(v, 0) & 0x7F for v in row.split(',') if v.strip()])
+    return frames
+
+
+def pack(frames):
+    width = len(frames[0])
+    data = list(frames[0])
+    for i in range(len(frames)):
+        a = frames[i]
+        b = frames[(i + 1) % len(frames)]
+        mask = [0] * ((width + 7) // 8)
+        changes = []
+        for c in range(width):
+            if a[c] != b[c]:
+                mask[c // 8] |= 1 << (c % 8)
+                changes.append(a[c] ^ b[c])
+        data += mask + changes
+    return data
+
+
+def main():
+    args = sys.argv[1:]
+    ms = 100
+    durations = None
+    rest = []
+    i = 0
+    while i < len(args):
+        if args[i] == '--ms' and i + 1 < len(args):
+            ms = int(args[i + 1])
+            i += 2
+        elif args[i] == '--durations' and i + 1 < len(args):
+            durations = [int(v) for v in args[i + 1].split(',')]
+            i += 2
+        else:
+            rest.append(args[i])
+            i += 1
+    if len(rest) != 2:
+        sys.exit(__doc__)
+    path, name = rest
+    frames = read_frames(open(path).read())
+    width = len(frames[0])
+    if any(len(f) != width for f in frames):
+        sys.exit('All frames must have the same number of columns')
+    if width > 255 or len(frames) > 0xFFFF:
+        sys.exit('Up to 255 columns and 65535 frames')
+    if durations is not None and len(durations) != len(frames):
+        sys.exit('--durations needs one time per frame')
+
+    data = pack(frames)
+    lower = name.lower()
+    raw = len(frames) * width
+    size = len(data) + (2 * len(durations) if durations else 0)
+
+    print('// Generated by extras/pack_animation.py from %s, do not edit.' % os.path.basename(path))
+    print('// %d frames, %d columns each, keyframe + XOR deltas: %d bytes of flash instead of %d.'
+          % (len(frames), width, size, raw))
+    print('')
+    print('const uint8_t %s_data[%d] PROGMEM = {' % (lower, len(data)))
+    for i in range(0, len(data), 16):
+        print('\t' + ' '.join('0x%02X,' % b for b in data[i:i + 16]))
+    print('};')
+    print('')
+    durations_name = 'NULL'
+    if durations:
+        durations_name = lower + '_ms'
+        print('const uint16_t %s[%d] PROGMEM = {' % (durations_name, len(durations)))
+        for i in range(0, len(durations), 12):
+            print('\t' + ' '.join('%5d,' % v for v in durations[i:i + 12]))
+        print('};')
+        print('')
+    print('const PixieAnimation %s = {%s_data, %s, %d, %d, %d};'
+          % (name, lower, durations_name, len(frames), ms, width))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Packs Pixie bitmaps into a PROGMEM PixieAssets header.
+
+Reads either a header of icon arrays like src/Pixie_Icon_Pack.h:
+
+    uint8_t PIX_ARROW_UP[] = {0x04,0x02,0x7F,0x02,0x04};
+
+or, with --font, a font table like src/font.h (5 columns per line, one
+glyph per line, ID = character - 32).
+
+Columns are stored 7 bits each, least significant bit first. With --rle
+each column is either a '1' bit and 7 literal bits, or a '0' bit and a
+3-bit count: the previous column (0 at the start of an asset) repeated
+1-8 times. RLE assets get an index of bit offsets, so it only pays off
+for bitmaps with long runs.
+
+Usage:
+    python3 pack_assets.py ../src/Pixie_Icon_Pack.h PIX_ICONS > ../src/Pixie_Icon_Pack_P.h
+    python3 pack_assets.py --font ../src/font.h PIX_FONT_7BIT > ../src/font_7bit.h
+
+Released under the GPLv3 license, all text here must be included in any redistribution.
+"""
+
+import os
+import re
+import sys
+
+
+def read_icons(text):
+    icons = []
+    for m in re.finditer(r'uint8_t\s+(\w+)\[\]\s*=\s*\{([^}]*)\}', text):
+        icons.append((m.group(1), [int(v, 0) for v in m.group(2).split(',') if v.strip()]))
+    return icons
+
+
+def read_font(text):
+    glyphs = []
+    for line in text.splitlines()[1:]:
+        code = line.split('//')[0]
+        values = re.findall(r'0x[0-9A-Fa-f]{2}', code)
+        if values:
+            glyphs.append((None, [int(v, 16) for v in values]))
+    size = re.search(r'\[(\d+)\]', text) # Zero-filled to the declared size
+    while size and len(glyphs) * 5 < int(size.group(1)):
+        glyphs.append((None, [0] * 5))
+    return glyphs
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        for i in range(n):
+            self.bits.append((value >> i) & 1)
+
+    def data(self):
+        out = []
+        for i in range(0, len(self.bits), 8):
+            byte = 0
+            for j, b in enumerate(self.bits[i:i + 8]):
+                byte |= b << j
+            out.append(byte)
+        return out
+
+
+def pack(assets, rle):
+    w = BitWriter()
+    index = []
+    for _, cols in assets:
+        index.append(len(w.bits))
+        if not rle:
+            for c in cols:
+                w.put(c & 0x7F, 7)
+            continue
+        prev = 0
+        i = 0
+        while i < len(cols):
+            run = 0
+            while i + run < len(cols) and cols[i + run] & 0x7F == prev and run < 8:
+                run += 1
+            if run:
+                w.put(0, 1)
+                w.put(run - 1, 3)
+                i += run
+            else:
+                prev = cols[i] & 0x7F
+                w.put(1, 1)
+                w.put(prev, 7)
+                i += 1
+    return w.data(), index
+
+
+def main():
+    args = sys.argv[1:]
+    rle = '--rle' in args
+    font = '--font' in args
+    args = [a for a in args if not a.startswith('--')]
+    if len(args) != 2:
+        sys.exit(__doc__)
+    path, name = args
+    text = open(path).read()
+    assets = read_font(text) if font else read_icons(text)
+    width = len(assets[0][1])
+    if any(len(cols) != width for _, cols in assets):
+        sys.exit('All assets must have the same number of columns')
+
+    data, index = pack(assets, rle)
+    if index[-1] > 0xFFFF:
+        sys.exit('Too many bits for a uint16_t index')
+    lower = name.lower()
+    raw = len(assets) * width
+    kind = 'glyphs' if font else 'icons'
+
+    print('// Generated by extras/pack_assets.py from %s, do not edit.' % os.path.basename(path))
+    print('// %d %s, %d columns each, %s: %d bytes of flash instead of %d.'
+          % (len(assets), kind, width, 'run-length coded' if rle else '7 bits per column', len(data) + 2 * len(index) * rle, raw))
+    print('')
+    if not font:
+        print('enum{')
+        for i, (n, _) in enumerate(assets):
+            ident = 'PIX_ICON_' + (n[4:] if n.startswith('PIX_') else n)
+            print('\t%s,%s// %d' % (ident, ' ' * max(1, 34 - len(ident)), i))
+        print('};')
+        print('')
+    print('const uint8_t %s_data[%d] PROGMEM = {' % (lower, len(data)))
+    for i in range(0, len(data), 16):
+        print('\t' + ' '.join('0x%02X,' % b for b in data[i:i + 16]))
+    print('};')
+    print('')
+    index_name = 'NULL'
+    if rle:
+        index_name = lower + '_index'
+        print('const uint16_t %s[%d] PROGMEM = {' % (index_name, len(index)))
+        for i in range(0, len(index), 12):
+            print('\t' + ' '.join('%5d,' % v for v in index[i:i + 12]))
+        print('};')
+        print('')
+    print('const PixieAssets %s = {%s_data, %s, %d, %d, %s};'
+          % (name, lower, index_name, len(assets), width, 'PIX_RLE' if rle else 'PIX_PACK7'))
+
+
+if __name__ == '__main__':
+    main()
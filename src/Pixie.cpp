@@ -20,6 +20,212 @@
 
 #include "Pixie.h"
 
+// CRC-8, polynomial 0x2F (Hamming distance 4 up to 119 data bits)
+static const uint8_t crc8_table[256] PROGMEM = {
+	0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0x57, 0x78, 0x09, 0x26, 0xEB, 0xC4, 0xB5, 0x9A,
+	0xAE, 0x81, 0xF0, 0xDF, 0x12, 0x3D, 0x4C, 0x63, 0xF9, 0xD6, 0xA7, 0x88, 0x45, 0x6A, 0x1B, 0x34,
+	0x73, 0x5C, 0x2D, 0x02, 0xCF, 0xE0, 0x91, 0xBE, 0x24, 0x0B, 0x7A, 0x55, 0x98, 0xB7, 0xC6, 0xE9,
+	0xDD, 0xF2, 0x83, 0xAC, 0x61, 0x4E, 0x3F, 0x10, 0x8A, 0xA5, 0xD4, 0xFB, 0x36, 0x19, 0x68, 0x47,
+	0xE6, 0xC9, 0xB8, 0x97, 0x5A, 0x75, 0x04, 0x2B, 0xB1, 0x9E, 0xEF, 0xC0, 0x0D, 0x22, 0x53, 0x7C,
+	0x48, 0x67, 0x16, 0x39, 0xF4, 0xDB, 0xAA, 0x85, 0x1F, 0x30, 0x41, 0x6E, 0xA3, 0x8C, 0xFD, 0xD2,
+	0x95, 0xBA, 0xCB, 0xE4, 0x29, 0x06, 0x77, 0x58, 0xC2, 0xED, 0x9C, 0xB3, 0x7E, 0x51, 0x20, 0x0F,
+	0x3B, 0x14, 0x65, 0x4A, 0x87, 0xA8, 0xD9, 0xF6, 0x6C, 0x43, 0x32, 0x1D, 0xD0, 0xFF, 0x8E, 0xA1,
+	0xE3, 0xCC, 0xBD, 0x92, 0x5F, 0x70, 0x01, 0x2E, 0xB4, 0x9B, 0xEA, 0xC5, 0x08, 0x27, 0x56, 0x79,
+	0x4D, 0x62, 0x13, 0x3C, 0xF1, 0xDE, 0xAF, 0x80, 0x1A, 0x35, 0x44, 0x6B, 0xA6, 0x89, 0xF8, 0xD7,
+	0x90, 0xBF, 0xCE, 0xE1, 0x2C, 0x03, 0x72, 0x5D, 0xC7, 0xE8, 0x99, 0xB6, 0x7B, 0x54, 0x25, 0x0A,
+	0x3E, 0x11, 0x60, 0x4F, 0x82, 0xAD, 0xDC, 0xF3, 0x69, 0x46, 0x37, 0x18, 0xD5, 0xFA, 0x8B, 0xA4,
+	0x05, 0x2A, 0x5B, 0x74, 0xB9, 0x96, 0xE7, 0xC8, 0x52, 0x7D, 0x0C, 0x23, 0xEE, 0xC1, 0xB0, 0x9F,
+	0xAB, 0x84, 0xF5, 0xDA, 0x17, 0x38, 0x49, 0x66, 0xFC, 0xD3, 0xA2, 0x8D, 0x40, 0x6F, 0x1E, 0x31,
+	0x76, 0x59, 0x28, 0x07, 0xCA, 0xE5, 0x94, 0xBB, 0x21, 0x0E, 0x7F, 0x50, 0x9D, 0xB2, 0xC3, 0xEC,
+	0xD8, 0xF7, 0x86, 0xA9, 0x64, 0x4B, 0x3A, 0x15, 0x8F, 0xA0, 0xD1, 0xFE, 0x33, 0x1C, 0x6D, 0x42
+};
+
+// Each 7-bit column upside down: bit 0 (top row) swapped with bit 6, and so on
+static const uint8_t bit_reverse7[128] PROGMEM = {
+	0x00, 0x40, 0x20, 0x60, 0x10, 0x50, 0x30, 0x70, 0x08, 0x48, 0x28, 0x68, 0x18, 0x58, 0x38, 0x78,
+	0x04, 0x44, 0x24, 0x64, 0x14, 0x54, 0x34, 0x74, 0x0C, 0x4C, 0x2C, 0x6C, 0x1C, 0x5C, 0x3C, 0x7C,
+	0x02, 0x42, 0x22, 0x62, 0x12, 0x52, 0x32, 0x72, 0x0A, 0x4A, 0x2A, 0x6A, 0x1A, 0x5A, 0x3A, 0x7A,
+	0x06, 0x46, 0x26, 0x66, 0x16, 0x56, 0x36, 0x76, 0x0E, 0x4E, 0x2E, 0x6E, 0x1E, 0x5E, 0x3E, 0x7E,
+	0x01, 0x41, 0x21, 0x61, 0x11, 0x51, 0x31, 0x71, 0x09, 0x49, 0x29, 0x69, 0x19, 0x59, 0x39, 0x79,
+	0x05, 0x45, 0x25, 0x65, 0x15, 0x55, 0x35, 0x75, 0x0D, 0x4D, 0x2D, 0x6D, 0x1D, 0x5D, 0x3D, 0x7D,
+	0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0B, 0x4B, 0x2B, 0x6B, 0x1B, 0x5B, 0x3B, 0x7B,
+	0x07, 0x47, 0x27, 0x67, 0x17, 0x57, 0x37, 0x77, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F,
+};
+
+// Reads **n** (1 to 8) PROGMEM bits at bit offset **bit**, least significant bit first
+static uint8_t read_bits(const uint8_t* data, uint32_t bit, uint8_t n){
+	const uint8_t* p = data + (bit >> 3);
+	uint8_t shift = bit & 7;
+	uint16_t w = pgm_read_byte(p);
+	if(shift + n > 8){
+		w |= pgm_read_byte(p+1) << 8;
+	}
+	return (w >> shift) & ((1 << n) - 1);
+}
+
+/*
+	Decodes the columns of one PixieAssets entry in order. PIX_PACK7 is 7 bits
+	per column, so any column can be found directly. PIX_RLE tokens are a 1
+	and 7 literal bits, or a 0 and a 3-bit count of repeats (1-8) of the
+	previous column, which starts as 0.
+*/
+struct AssetReader{
+	const uint8_t* data;
+	uint32_t bit;
+	bool rle;
+	uint8_t prev;
+	uint8_t run; // Repeats of prev still to come
+	
+	AssetReader(const PixieAssets& set, uint16_t id){
+		data = set.data;
+		rle  = (set.format == PIX_RLE);
+		prev = 0;
+		run  = 0;
+		if(rle){
+			bit = pgm_read_word(set.index + id);
+		}
+		else{
+			bit = (uint32_t)id * set.width * 7;
+		}
+	}
+	
+	uint8_t next(){
+		if(!rle){
+			uint8_t c = read_bits(data, bit, 7);
+			bit += 7;
+			return c;
+		}
+		if(run == 0){
+			if(read_bits(data, bit, 1)){
+				prev = read_bits(data, bit+1, 7);
+				bit += 8;
+				return prev;
+			}
+			run = read_bits(data, bit+1, 3) + 1;
+			bit += 4;
+		}
+		run--;
+		return prev;
+	}
+	
+	void skip(uint16_t n){
+		if(!rle){
+			bit += (uint32_t)n * 7;
+			return;
+		}
+		while(n--){
+			next();
+		}
+	}
+};
+
+// "00" to "99", so each division by 100 gives two digits
+static const char digit_pairs[201] PROGMEM =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+static const uint32_t powers_of_ten[10] PROGMEM = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Number of decimal digits in **value**, by comparison instead of division
+static uint8_t count_digits(uint32_t value){
+	uint8_t n = 1;
+	while(n < 10 && value >= pgm_read_dword(powers_of_ten + n)){
+		n++;
+	}
+	return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Writes the decimal digits of **value** to **out** as characters,
+	least significant first, and returns how many: at least **min**, with
+	no leading zeros beyond that. **out** needs room for 12 characters.
+	Only values of 10000 and up need a real division. Each 4-digit group
+	is split with a reciprocal multiply (x * 5243 >> 19 is x / 100 for
+	x < 10000) and two lookups in digit_pairs. Used by every number
+	write(), print(), push() and shift(), and by PixieCounter.
+*/
+/**************************************************************************/
+uint8_t Pixie::decimal_digits(uint32_t value, char* out, uint8_t min){
+	uint8_t n = 0;
+	do{
+		uint16_t group;
+		if(value >= 10000){
+			uint32_t q = value / 10000;
+			group = value - q*10000;
+			value = q;
+		}
+		else{
+			group = value;
+			value = 0;
+		}
+		uint8_t hundreds = ((uint32_t)group * 5243) >> 19;
+		const char* lo = digit_pairs + (group - hundreds*100)*2;
+		const char* hi = digit_pairs + hundreds*2;
+		out[n++] = pgm_read_byte(lo+1);
+		out[n++] = pgm_read_byte(lo);
+		out[n++] = pgm_read_byte(hi+1);
+		out[n++] = pgm_read_byte(hi);
+	}while(value != 0 || n < min);
+	while(n > min && n > 1 && out[n-1] == '0'){
+		n--;
+	}
+	return n;
+}
+
+static PixieNumber number(int32_t input){
+	PixieNumber n = {(uint32_t)input, 0, 0, input < 0, NULL};
+	if(n.negative){
+		n.whole = 0 - n.whole; // Also right for INT32_MIN
+	}
+	return n;
+}
+
+static PixieNumber number(uint32_t input){
+	PixieNumber n = {input, 0, 0, false, NULL};
+	return n;
+}
+
+/*
+	Splits a float into whole and fractional integers, rounded to **places**
+	(at most 9), so it can be shown without sprintf("%f"). Like Arduino's
+	Print, values that don't fit in 32 bits show as "ovf".
+*/
+static PixieNumber number(double input, uint8_t places){
+	if(places > 9){
+		places = 9;
+	}
+	PixieNumber n = {0, 0, places, input < 0, NULL};
+	if(isnan(input)){
+		n.text = "nan";
+		n.negative = false;
+		return n;
+	}
+	if(isinf(input)){
+		n.text = "inf";
+		return n;
+	}
+	if(n.negative){
+		input = -input;
+	}
+	if(input > 4294967040.0){
+		n.text = "ovf";
+		return n;
+	}
+	uint32_t scale = pgm_read_dword(powers_of_ten + places);
+	n.whole = input;
+	n.frac  = (input - n.whole) * scale + 0.5;
+	if(n.frac >= scale){ // Rounded up into the whole part
+		n.frac -= scale;
+		n.whole++;
+	}
+	return n;
+}
+
 /**************************************************************************/
 /*!
 	Used to initialize the Pixie library. Example usage before setup() would be:
@@ -33,19 +239,54 @@
 	</pre>
 */
 /**************************************************************************/
-Pixie::Pixie(uint8_t p_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type){
+Pixie::Pixie(uint8_t p_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type)
+	: Pixie(p_count, c_pin, d_pin, p_type, NULL, 0, NULL, NULL){
+}
+
+// Takes storage for frame (**frame_len** columns), the wire layout and the
+// attributes if given, allocates them otherwise. PixieFixed passes arrays of its own.
+Pixie::Pixie(uint8_t p_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type, uint8_t* frame_buf, uint16_t frame_len, uint8_t* display_buf, uint8_t* attr_buf){
 	CLK_pin = c_pin;
 	DAT_pin = d_pin;
 	pixie_count = p_count;
 	disp_count  = pixie_count*2;
 	
 	pix_type = p_type;
+	if(pix_type == PRO_CRC){ // Same layout as PRO, only the check bits differ
+		pix_type = PRO;
+		crc_packets = true;
+	}
 	
+	frame_cols = disp_count*5; // canvas() can make this wider than the chain
+	frame = frame_buf;
+	frame_size = frame_len;
+	if(frame == NULL){
+		frame = new uint8_t[frame_cols];
+	}
+	memset(frame, 0, frame_cols);
+	
+	attributes = attr_buf;
+	if(attributes == NULL){
+		attributes = new uint8_t[disp_count];
+	}
+	memset(attributes, 0, disp_count);
+	
+	display_buffer = display_buf;
 	if(pix_type == PRO){
-		display_buffer = new uint8_t[pixie_count*13];
+		if(display_buffer == NULL){
+			display_buffer = new uint8_t[pixie_count*13];
+		}
+		memset(display_buffer, 0, pixie_count*13);
+		fill_commands(0, pixie_count);
 	}
 	else{
-		display_buffer = new uint8_t[disp_count*8];
+		if(display_buffer == NULL){
+			display_buffer = new uint8_t[disp_count*8];
+		}
+		memset(display_buffer, 0, disp_count*8);
+	}
+	for(uint8_t i = 0; i < pixie_count; i++){
+		set_brightness(bright, i);
 	}
 }
 
@@ -53,26 +294,33 @@ Pixie::Pixie(uint8_t p_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type){
 /*!
     @brief	Initializes the display buffer and clears the displays (Should be called once in the Arduino setup() function)
 	
-    @param	speed Can either be omitted/LEGACY_SPEED (39kHz) or FULL_SPEED (67kHz)
+    @param	speed Can either be omitted/LEGACY_SPEED (39kHz), FULL_SPEED (67kHz) or USI_SPEED (250kHz, Firmware 1.4.0 USI only,
+	              so PRO_CRC only: other types get FULL_SPEED instead)
 */
 /**************************************************************************/
 void Pixie::begin(uint8_t speed){
 	clk_us = speed;
+	if(clk_us < FULL_SPEED && !crc_packets){ // USI_SPEED needs firmware 1.4.0, which is PRO_CRC only
+		clk_us = FULL_SPEED;
+	}
 	pinMode(CLK_pin, OUTPUT);
 	pinMode(DAT_pin, OUTPUT);
 	reset(); 
 	clear();
 	if(pix_type == PRO){ // Pro has different hardware requirements!
-		clk_us = FULL_SPEED;
+		if(clk_us > FULL_SPEED){ // Pro is at least FULL_SPEED, faster if asked for
+			clk_us = FULL_SPEED;
+		}
 		command(PIX_ROW_CURRENT, mA_10);
 		command(PIX_LED_FLIP,    true);
 	}
 	delay(10); // Give Pixies a short time to finish resetting
 }
 
-void Pixie::calc_parity(){
-	uint16_t byte_count = pixie_count * 13;
-	for (uint16_t b = 0; b < byte_count; b++) {
+// Parity of the packets of modules **first** to **end**-1
+void Pixie::calc_parity(uint8_t first, uint8_t end){
+	uint16_t byte_count = end * 13;
+	for (uint16_t b = first * 13; b < byte_count; b++) {
 		uint8_t num_1s = 0;
 		num_1s += bitRead(display_buffer[b],0);
 		num_1s += bitRead(display_buffer[b],1);
@@ -85,12 +333,377 @@ void Pixie::calc_parity(){
 	}
 }
 
-void Pixie::fill_commands(){
-	for(uint8_t i = 0; i < pixie_count; i++){
-		write_byte(PIX_WRITE, 0+(13*i)); // command, command data, 7-bit brightness
-		write_byte(0,         1+(13*i));
-		write_byte(bright,    2+(13*i));
+/*
+	Firmware 1.3.0+ packets carry a CRC-8 (init 0xFF, xorout 0xFF) of the
+	13 seven-bit bytes instead of parity. It is sent MSB-first in bit 7 of
+	bytes 0-7, and bit 7 of bytes 8-12 is left at 0. Only modules **first**
+	to **end**-1 are done.
+*/
+void Pixie::calc_crc(uint8_t first, uint8_t end){
+	for(uint8_t p = first; p < end; p++){
+		uint8_t* packet = display_buffer + p*13;
+		uint8_t crc = 0xFF;
+		for(uint8_t b = 0; b < 13; b++){
+			packet[b] &= 0x7F;
+			crc = pgm_read_byte(crc8_table + (crc ^ packet[b]));
+		}
+		crc ^= 0xFF;
+		for(uint8_t b = 0; b < 8; b++){
+			packet[b] |= (crc << b) & 0x80;
+		}
+	}
+}
+
+// Byte 2 of each header is that module's brightness, see set_brightness()
+void Pixie::fill_commands(uint8_t first, uint8_t end){
+	for(uint8_t i = first; i < end; i++){
+		display_buffer[13*i+0] = PIX_WRITE; // command, command data
+		display_buffer[13*i+1] = 0;
+	}
+}
+
+/*
+	All drawing goes into frame[], one byte per column from left to right,
+	bit 0 at the top. frame[] is circular: the leftmost column is stored at
+	frame_head, so push/shift only move the head and write one column.
+	Only the chain-wide window starting at view_x is sent.
+	This copies it between the headers of the wire layout: PRO packs two
+	positions per 13-byte module packet, LEGACY sends each position as its
+	own 8-byte packet. Bit 7 belongs to the wire layer. Only modules
+	**first** to **end**-1 are encoded, the rest of the buffer is left as
+	it was. The orientation is applied here and nowhere else: a table
+	lookup per column to turn it upside down, and the columns read right
+	to left to mirror the chain. Attributes are applied to the packets
+	afterwards, see apply_attributes().
+*/
+void Pixie::encode(uint8_t first, uint8_t end){
+	uint8_t  stride = 8;
+	uint8_t  cols   = 5;
+	uint16_t p      = first * 2;
+	uint16_t count  = end * 2;
+	if(pix_type == PRO){
+		stride = 13;
+		cols   = 10;
+		p      = first;
+		count  = end;
+	}
+	
+	// Mirrored in X, the chain shows the viewport from its right edge leftwards
+	bool mirror_x = orientation & PIX_MIRROR_X;
+	bool mirror_y = orientation & PIX_MIRROR_Y;
+	uint16_t k = first * 10; // Visible column, < frame_cols
+	if(mirror_x){
+		k = disp_count*5 - 1 - k;
+	}
+	uint16_t i = frame_index(view_x) + k;
+	if(i >= frame_cols){
+		i -= frame_cols;
+	}
+	uint8_t* dst = display_buffer + 3 + p * stride;
+	for(; p < count; p++){
+		for(uint8_t c = 0; c < cols; c++){
+			uint8_t col = frame[i] & 0x7F;
+			if(mirror_y){
+				col = pgm_read_byte(bit_reverse7 + col);
+			}
+			dst[c] = col;
+			if(mirror_x){
+				i = (i == 0 ? frame_cols : i) - 1;
+			}
+			else if(++i == frame_cols){
+				i = 0;
+			}
+		}
+		dst += stride;
+	}
+	if(attr_count > 0){
+		apply_attributes(first, end);
+	}
+}
+
+// Applies set_attribute() to the encoded positions of modules **first** to
+// **end**-1, on their wire columns. Inverting, blanking and the checkerboard
+// are the same either way up, only the underline row moves with PIX_MIRROR_Y.
+void Pixie::apply_attributes(uint8_t first, uint8_t end){
+	bool mirror_x = orientation & PIX_MIRROR_X;
+	uint8_t under = (orientation & PIX_MIRROR_Y) ? 0x01 : 0x40;
+	for(uint8_t wp = first*2; wp < end*2; wp++){ // Positions along the wire
+		uint8_t attr = attributes[mirror_x ? disp_count-1 - wp : wp];
+		if(attr == 0){
+			continue;
+		}
+		uint8_t* dst = display_buffer + 3 + wp*8;
+		if(pix_type == PRO){ // Two positions per 13-byte packet
+			dst = display_buffer + 3 + (wp >> 1)*13 + (wp & 1)*5;
+		}
+		if((attr & PIX_BLINK) && !blink_on){
+			memset(dst, 0, 5);
+			continue;
+		}
+		for(uint8_t c = 0; c < 5; c++){
+			uint8_t col = dst[c];
+			if(attr & PIX_UNDERLINE){
+				col |= under;
+			}
+			if(attr & PIX_INVERT){
+				col ^= 0x7F;
+			}
+			if(attr & PIX_DIM){
+				col &= (c & 1) ? 0x2A : 0x55;
+			}
+			dst[c] = col;
+		}
+	}
+}
+
+// Storage index of logical column **x** (0 to frame_cols-1)
+uint16_t Pixie::frame_index(uint16_t x){
+	x += frame_head;
+	if(x >= frame_cols){
+		x -= frame_cols;
+	}
+	return x;
+}
+
+// Copies **n** PROGMEM columns to logical column **x**, in two parts if they wrap
+void Pixie::copy_columns_P(uint16_t x, const uint8_t* src, uint16_t n){
+	uint16_t i = frame_index(x);
+	uint16_t room = frame_cols - i;
+	if(n <= room){
+		memcpy_P(frame + i, src, n);
+	}
+	else{
+		memcpy_P(frame + i, src, room);
+		memcpy_P(frame, src + room, n - room);
+	}
+}
+
+// Copies **n** PROGMEM columns (blank ones if **src** is NULL) to column **x**,
+// clipped to the buffer. Returns the number of columns written.
+uint16_t Pixie::put_columns(int16_t x, const uint8_t* src, uint16_t n){
+	int16_t first = 0;
+	int16_t last  = n;
+	if(x < 0){
+		first = -x;
+	}
+	if(x + last > (int16_t)frame_cols){
+		last = frame_cols - x;
+	}
+	if(first >= last){
+		return 0;
+	}
+	if(src == NULL){
+		span(x + first, last - first, 0x7F, 0);
+	}
+	else{
+		copy_columns_P(x + first, src + first, last - first);
+	}
+	return last - first;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the five PROGMEM columns of **chr** in the selected font.
+	Control characters (below 32) pick font glyph **chr** directly, as
+	they always have; bytes past the font without an extended glyph map
+	to a space.
+*/
+/**************************************************************************/
+const uint8_t* Pixie::glyph(char chr){
+	uint8_t index = chr;
+	if (index >= 32) {
+		index -= 32;
+	}
+	if (index >= sizeof(col)/5) {
+		const uint8_t* ext = ext_glyph((uint8_t)chr); // Latin-1 byte
+		if(ext != NULL){
+			return ext;
+		}
+		index = 0;
+	}
+	return col + index*5;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the PROGMEM columns of **chr** in a proportional font and
+	stores their number in **width**. Characters outside the font, control
+	characters included, map to its first glyph.
+*/
+/**************************************************************************/
+const uint8_t* Pixie::glyph(char chr, const PixieFont& font, uint8_t* width){
+	uint8_t index = (uint8_t)chr - font.first;
+	if (index >= font.count) {
+		index = 0;
+	}
+	uint16_t start = pgm_read_word(font.offsets + index);
+	*width = pgm_read_word(font.offsets + index + 1) - start;
+	return font.columns + start;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of blank columns between **chr** and **next**
+	in a proportional font: its spacing plus their kerning adjustment, if
+	any. **next** is 0 after the last character.
+*/
+/**************************************************************************/
+uint8_t Pixie::glyph_spacing(char chr, char next, const PixieFont& font){
+	int8_t gap = font.spacing;
+	if(font.kerning != NULL && next != 0){
+		for(const int8_t* k = font.kerning; pgm_read_byte(k) != 0; k += 3){
+			uint8_t left = pgm_read_byte(k);
+			if(left > (uint8_t)chr){
+				break; // Sorted, no pair for chr
+			}
+			if(left == (uint8_t)chr && pgm_read_byte(k+1) == (uint8_t)next){
+				gap += (int8_t)pgm_read_byte(k+2);
+				break;
+			}
+		}
+	}
+	if(gap < 0){
+		gap = 0;
+	}
+	return gap;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the glyphs used for characters beyond ASCII, such as
+	PIX_GLYPHS_EXT from font_ext.h. Without them those characters show as
+	a space.
+*/
+/**************************************************************************/
+void Pixie::set_glyphs(const PixieGlyphs& glyphs){
+	ext_glyphs = &glyphs;
+}
+
+// Binary search of the extended glyphs for **code**, NULL if it has none
+const uint8_t* Pixie::ext_glyph(uint16_t code){
+	if(ext_glyphs == NULL){
+		return NULL;
+	}
+	uint16_t lo = 0;
+	uint16_t hi = ext_glyphs->count;
+	while(lo < hi){
+		uint16_t mid = (lo + hi) / 2;
+		uint16_t c = pgm_read_word(ext_glyphs->codepoints + mid);
+		if(c == code){
+			return ext_glyphs->columns + mid*5;
+		}
+		if(c < code){
+			lo = mid + 1;
+		}
+		else{
+			hi = mid;
+		}
+	}
+	return NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Decodes the UTF-8 character at **input** and moves **input** past
+	it. A byte that doesn't start a valid sequence is taken as Latin-1, and
+	characters beyond U+FFFF return 0xFFFF.
+*/
+/**************************************************************************/
+uint16_t Pixie::next_codepoint(char*& input){
+	uint8_t lead = *input++;
+	if(lead < 0x80){
+		return lead;
+	}
+	uint8_t extra;
+	uint16_t code;
+	if(lead >= 0xC2 && lead < 0xE0){
+		extra = 1;
+		code  = lead & 0x1F;
+	}
+	else if(lead >= 0xE0 && lead < 0xF0){
+		extra = 2;
+		code  = lead & 0x0F;
+	}
+	else if(lead >= 0xF0 && lead < 0xF5){
+		extra = 3;
+		code  = 0;
+	}
+	else{
+		return lead; // Stray continuation byte, or Latin-1 text
+	}
+	char* p = input;
+	for(uint8_t i = 0; i < extra; i++, p++){
+		if(((uint8_t)*p & 0xC0) != 0x80){
+			return lead; // Truncated sequence
+		}
+		code = (code << 6) | (*p & 0x3F);
+	}
+	input = p;
+	if(extra == 3){
+		return 0xFFFF;
+	}
+	return code;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the five PROGMEM columns of the UTF-8 character at
+	**input** and moves **input** past it. ASCII goes straight to glyph(),
+	anything else to the extended glyphs, or a space if it isn't there.
+*/
+/**************************************************************************/
+const uint8_t* Pixie::next_glyph(char*& input){
+	if((uint8_t)*input < 0x80){
+		return glyph(*input++);
+	}
+	const uint8_t* ext = ext_glyph(next_codepoint(input));
+	if(ext == NULL){
+		return glyph(' ');
+	}
+	return ext;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Proportional version of next_glyph(). Extended glyphs are 5
+	columns wide, so their blank edge columns are trimmed here.
+*/
+/**************************************************************************/
+const uint8_t* Pixie::next_glyph(char*& input, const PixieFont& font, uint8_t* width){
+	if((uint8_t)*input < 0x80){
+		return glyph(*input++, font, width);
+	}
+	const uint8_t* ext = ext_glyph(next_codepoint(input));
+	uint8_t first = 0;
+	uint8_t last  = 5;
+	if(ext != NULL){
+		while(first < last && pgm_read_byte(ext + first) == 0){
+			first++;
+		}
+		while(last > first && pgm_read_byte(ext + last-1) == 0){
+			last--;
+		}
+	}
+	if(first == last){
+		return glyph(' ', font, width); // Missing or blank
 	}
+	*width = last - first;
+	return ext + first;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of characters in a UTF-8 string, which is its
+	width in positions with the 5 column font.
+*/
+/**************************************************************************/
+uint16_t Pixie::text_length(char* input){
+	uint16_t len = 0;
+	while(*input != 0){
+		next_codepoint(input);
+		len++;
+	}
+	return len;
 }
 
 /**************************************************************************/
@@ -100,15 +713,106 @@ void Pixie::fill_commands(){
 /**************************************************************************/
 void Pixie::show(bool fill_com){
 	yield();
+	send(prepare(fill_com, 0, pixie_count));
+	dirty_first = 255;
+	dirty_last  = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Like show(), but only re-encodes the modules marked with
+	mark_dirty() since the last show(), and sends nothing at all if none
+	were. Stock firmware shifts every packet through the whole chain, so
+	anything sent is the whole chain; what this saves is the encoding, and
+	the frames where nothing changed.
+	
+	Only marked modules are tracked. write(), print(), push(), shift(),
+	clear(), set_pix() and the draw functions mark nothing, so follow them
+	with mark_dirty() or a full show(). PixiePlayer, PixieLayers,
+	PixieTransition, the widgets, brightness changes and command() mark
+	what they change themselves.
+	
+    @return	True if anything was sent
+*/
+/**************************************************************************/
+bool Pixie::show_changes(){
+	if(dirty_first > dirty_last){
+		return false;
+	}
+	yield();
+	send(prepare(true, dirty_first, dirty_last + 1));
+	dirty_first = 255;
+	dirty_last  = 0;
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Marks the modules showing columns **x** to **x**+**w**-1 of the
+	display buffer as changed, for show_changes(). With a canvas wider
+	than the chain, the whole chain is marked.
+*/
+/**************************************************************************/
+void Pixie::mark_dirty(int16_t x, uint16_t w){
+	if(frame_cols != disp_count*5){ // Canvas: leave the viewport math to show()
+		mark_modules(0, pixie_count-1);
+		return;
+	}
+	if(x < 0){
+		if(w <= (uint16_t)-x){
+			return;
+		}
+		w += x;
+		x = 0;
+	}
+	if(w == 0 || x >= (int16_t)frame_cols){
+		return;
+	}
+	uint16_t last = x + w - 1;
+	if(last >= frame_cols){
+		last = frame_cols - 1;
+	}
+	if(orientation & PIX_MIRROR_X){ // Modules are counted along the wire
+		mark_modules(pixie_count-1 - last/10, pixie_count-1 - x/10);
+	}
+	else{
+		mark_modules(x / 10, last / 10);
+	}
+}
+
+// Widens the dirty range to modules **first** to **last**
+void Pixie::mark_modules(uint8_t first, uint8_t last){
+	if(first < dirty_first){
+		dirty_first = first;
+	}
+	if(last > dirty_last){
+		dirty_last = last;
+	}
+}
+
+// Encodes modules **first** to **end**-1 of frame[] into the wire layout with
+// their check bits, returns the size of the whole layout
+uint16_t Pixie::prepare(bool fill_com, uint8_t first, uint8_t end){
+	encode(first, end);
 	uint16_t total_bytes = disp_count * 8;
 	if(pix_type == PRO){
 		total_bytes = pixie_count * 13;
 		if(fill_com){
-			fill_commands();
+			fill_commands(first, end);
+		}
+		if(crc_packets){
+			calc_crc(first, end);
+		}
+		else{
+			calc_parity(first, end);
 		}
-		calc_parity();
 	}
-	
+	return total_bytes;
+}
+
+// Clocks out the first **total_bytes** of display_buffer, MSB first, then
+// waits for the modules to latch
+void Pixie::send(uint16_t total_bytes){
 	#ifdef SAMD_SERIES
 		EPortType port_clk   = g_APinDescription[CLK_pin].ulPort;
 		uint32_t pin_clk     = g_APinDescription[CLK_pin].ulPin;
@@ -221,84 +925,102 @@ void Pixie::show(bool fill_com){
 */
 /**************************************************************************/
 void Pixie::brightness(uint8_t b){
+	bright = b;
+	for(uint8_t i = 0; i < pixie_count; i++){
+		set_brightness(b, i);
+	}
+	show();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the brightness of one Pixie module in the display buffer. Nothing
+	is sent: the next show() carries every module's level in the packets it
+	sends anyway, so changing any number of them costs no extra frames.
+	
+    @param	b		7-bit brightness level (0-127)
+	@param	module	Module to set, 0 is the one showing display positions 0 and 1
+*/
+/**************************************************************************/
+void Pixie::set_brightness(uint8_t b, uint8_t module){
+	if(module >= pixie_count){
+		return;
+	}
+	b &= 0x7F;
 	if(pix_type == PRO){
-		bright = b;
-		fill_commands();
-		show();
+		display_buffer[13*module+2] = b; // Bit 7 is rewritten by calc_parity()/calc_crc()
 	}
 	else{
-		bitWrite(b,7,1);
-		bright = b;
-		for(uint8_t i = 0; i < disp_count; i++){
-			write_brightness(b, i);
-		}
-		show();
+		display_buffer[16*module+1] = b | 0x80; // Bit 7 marks the PWM byte to LEGACY firmware
+		display_buffer[16*module+9] = b | 0x80;
 	}
+	mark_modules(module, module);
 }
 
 /**************************************************************************/
 /*!
-    @brief	Clears the display buffer
+    @brief	Sets the brightness of every module from **levels** (module_count()
+	entries), to be sent by the next show()
 */
 /**************************************************************************/
-void Pixie::clear(){
-	for (uint16_t d = 0; d < disp_count*8; d++) {
-		display_buffer[d] = 0;
+void Pixie::set_brightness(const uint8_t* levels){
+	for(uint8_t i = 0; i < pixie_count; i++){
+		set_brightness(levels[i], i);
 	}
-	cursor_pos = 0;
 }
 
 /**************************************************************************/
 /*!
-    @brief	Sets a pixel at coordinate (**x**,**y**) to **state**.
-	
-    @param	x		X coordinate
-	@param	y		Y coordinate
-	@param	state	On (true) or off (false)
+    @brief	Returns the brightness (0-127) **module** will get with the next show()
 */
 /**************************************************************************/
-void Pixie::set_pix(uint16_t x, uint16_t y, uint8_t state){
-	if(pix_type == PRO){
-		uint16_t max_x = pixie_count*13-1;
-		uint8_t max_y = 6;
-		
-		x = max_x - x;
-		y = max_y - y;
-		
-		if(x >= 0 && y >= 0){
-			if(x < pixie_count*13 && y < 8){
-				bitWrite(display_buffer[x],y,state);
-			}
-		}
+uint8_t Pixie::get_brightness(uint8_t module){
+	if(module >= pixie_count){
+		return 0;
 	}
-	else{
-		uint16_t max_x = disp_count*8-1;
-		uint8_t max_y = 6;
-		
-		x = max_x - x;
-		y = max_y - y;
-		
-		if(x >= 0 && y >= 0){
-			if(x < disp_count*8 && y < 8){
-				bitWrite(display_buffer[x],y,state);
-			}
-		}
+	if(pix_type == PRO){
+		return display_buffer[13*module+2] & 0x7F;
 	}
+	return display_buffer[16*module+1] & 0x7F;
 }
 
 /**************************************************************************/
 /*!
-    @brief	Writes a floating-point number to the Pixies up to a specified decimal precision.
-	
-    @param	input	Number to write
-	@param	places	Number of decimal places to write
-	@param	pos     Position in the chain to start writing
+    @brief	Clears the display buffer
+*/
+/**************************************************************************/
+void Pixie::clear(){
+	memset(frame, 0, frame_cols);
+	frame_head = 0;
+	cursor_pos = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets a pixel at coordinate (**x**,**y**) to **state**.
+	
+    @param	x		X coordinate (column, 0 is the leftmost)
+	@param	y		Y coordinate (row, 0 is the top)
+	@param	state	On (true) or off (false)
+*/
+/**************************************************************************/
+void Pixie::set_pix(uint16_t x, uint16_t y, uint8_t state){
+	if(x < frame_cols && y < 7){
+		bitWrite(frame[frame_index(x)],y,state);
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Writes a floating-point number to the Pixies up to a specified decimal precision.
+	
+    @param	input	Number to write
+	@param	places	Number of decimal places to write
+	@param	pos     Position in the chain to start writing
 */
 /**************************************************************************/
 void Pixie::write(float input, uint8_t places, uint8_t pos){
-	char char_buf[48];	
-	sprintf(char_buf, "%.*f", places, input);
-	write(char_buf, pos);
+	write_number(number(input, places), pos);
 }
 
 /**************************************************************************/
@@ -311,9 +1033,7 @@ void Pixie::write(float input, uint8_t places, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(double input, uint8_t places, uint8_t pos){
-	char char_buf[48];	
-	sprintf(char_buf, "%.*f", places, input);
-	write(char_buf, pos);
+	write_number(number(input, places), pos);
 }
 
 /**************************************************************************/
@@ -325,9 +1045,7 @@ void Pixie::write(double input, uint8_t places, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(int16_t input, uint8_t pos){
-	char char_buf[48];
-	itoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((int32_t)input), pos);
 }
 
 /**************************************************************************/
@@ -339,9 +1057,7 @@ void Pixie::write(int16_t input, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(uint16_t input, uint8_t pos){
-	char char_buf[48];
-	utoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((uint32_t)input), pos);
 }
 
 /**************************************************************************/
@@ -353,9 +1069,7 @@ void Pixie::write(uint16_t input, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(int32_t input, uint8_t pos){
-	char char_buf[48];
-	ltoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((int32_t)input), pos);
 }
 
 /**************************************************************************/
@@ -367,9 +1081,7 @@ void Pixie::write(int32_t input, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(uint32_t input, uint8_t pos){
-	char char_buf[48];
-	ultoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((uint32_t)input), pos);
 }
 
 /**************************************************************************/
@@ -382,9 +1094,7 @@ void Pixie::write(uint32_t input, uint8_t pos){
 /**************************************************************************/
 #if defined(ESP8266) || defined(ESP32)
 	void Pixie::write(long unsigned int input, uint8_t pos){
-		char char_buf[48];
-		ultoa(input,char_buf,10);
-		write(char_buf, pos);
+		write_number(number((uint32_t)input), pos);
 	}
 #endif
 
@@ -409,37 +1119,7 @@ void Pixie::write(char input, uint8_t pos){
 */
 /**************************************************************************/
 void Pixie::write(uint8_t* icon, uint8_t pos) {
-	if(pix_type == PRO){
-		if(pos < disp_count){				
-			uint8_t offset = 0;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 5;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(icon[0],  7+(13*pos_even)+offset);
-			write_byte(icon[1],  6+(13*pos_even)+offset);
-			write_byte(icon[2],  5+(13*pos_even)+offset);
-			write_byte(icon[3],  4+(13*pos_even)+offset);
-			write_byte(icon[4],  3+(13*pos_even)+offset);
-		}
-	}
-	else{
-		if(pos < disp_count){		
-			display_buffer[8*pos+0] = 0;
-			display_buffer[8*pos+1] = bright;
-			display_buffer[8*pos+2] = 0;
-			
-			display_buffer[8*pos+3] = icon[0];
-			display_buffer[8*pos+4] = icon[1];
-			display_buffer[8*pos+5] = icon[2];
-			display_buffer[8*pos+6] = icon[3];
-			display_buffer[8*pos+7] = icon[4];
-		}
-		set_cursor(pos+1);
-	}
+	write(icon[0], icon[1], icon[2], icon[3], icon[4], pos);
 }
 
 /**************************************************************************/
@@ -455,38 +1135,11 @@ void Pixie::write(uint8_t* icon, uint8_t pos) {
 */
 /**************************************************************************/
 void Pixie::write(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5, uint8_t pos){
-	if(pix_type == PRO){
-		if(pos < disp_count){				
-			uint8_t offset = 5;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 0;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(byte1,  7+(13*pos_even)+offset);
-			write_byte(byte2,  6+(13*pos_even)+offset);
-			write_byte(byte3,  5+(13*pos_even)+offset);
-			write_byte(byte4,  4+(13*pos_even)+offset);
-			write_byte(byte5,  3+(13*pos_even)+offset);
-		}
-	}
-	else{
-		if(pos < disp_count){		
-			display_buffer[8*pos+0] = 0;
-			display_buffer[8*pos+1] = bright;
-			display_buffer[8*pos+2] = 0;
-			
-			display_buffer[8*pos+3] = byte1;
-			display_buffer[8*pos+4] = byte2;
-			display_buffer[8*pos+5] = byte3;
-			display_buffer[8*pos+6] = byte4;
-			display_buffer[8*pos+7] = byte5;
-			
-			set_cursor(pos+1);
-		}
+	uint8_t bytes[5] = {byte1, byte2, byte3, byte4, byte5};
+	if(pos < frame_cols/5){
+		blit(bytes, 5, pos*5, 0, PIX_OP_COPY);
 	}
+	set_cursor(pos+1);
 }
 
 /**************************************************************************/
@@ -498,125 +1151,283 @@ void Pixie::write(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, ui
 */
 /**************************************************************************/
 void Pixie::write(char* input, uint8_t pos){
-	uint8_t len = strlen(input);
-	if(len > disp_count-pos){
-		len = disp_count-pos;
+	uint16_t width = draw_text(input, pos*5);
+	set_cursor(pos + width/5);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Renders a string into the display buffer starting at column **x**.
+	Each glyph is a single PROGMEM block copy, clipped to the chain.
+	
+    @param	input	char[]/char* to render
+	@param	x		Column of the first glyph's left edge, can be negative
+	@return	Number of columns rendered after clipping
+*/
+/**************************************************************************/
+uint16_t Pixie::draw_text(char* input, int16_t x){
+	uint16_t rendered = 0;
+	int16_t x_max = frame_cols;
+	for(; *input != 0 && x < x_max; x += 5){
+		rendered += put_columns(x, next_glyph(input), 5);
 	}
-	for(uint8_t i = 0; i < len; i++){
-		write_char(input[i], i+pos);
+	return rendered;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Copies **width** PROGMEM columns to the display buffer starting
+	at column **x**, clipped to the chain/canvas. This is how a PIXIE_TEXT()
+	label or any other prerendered bitmap in flash is drawn.
+	
+    @param	columns	PROGMEM columns, bit 0 at the top
+	@param	width	Number of columns
+	@param	x		Column of the left edge, can be negative
+	@return	Number of columns rendered after clipping
+*/
+/**************************************************************************/
+uint16_t Pixie::draw_P(const uint8_t* columns, uint16_t width, int16_t x){
+	return put_columns(x, columns, width);
+}
+
+// write() for a PIXIE_TEXT() label: draws it at **pos** and moves the cursor past it
+void Pixie::write_P(const uint8_t* columns, uint16_t width, uint8_t pos){
+	uint16_t rendered = put_columns(pos*5, columns, width);
+	set_cursor(pos + rendered/5);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Renders a string in a proportional font starting at column **x**.
+	Each glyph takes only its own columns plus the font's spacing (less any
+	kerning with the next character), clipped to the chain/canvas.
+	
+    @param	input	char[]/char* to render
+	@param	x		Column of the first glyph's left edge, can be negative
+	@param	font	Font to render with, such as PIX_FONT_PROP
+	@return	Number of columns rendered after clipping
+*/
+/**************************************************************************/
+uint16_t Pixie::draw_text(char* input, int16_t x, const PixieFont& font){
+	uint16_t rendered = 0;
+	int16_t x_max = frame_cols;
+	while(*input != 0 && x < x_max){
+		uint8_t width;
+		char chr = *input;
+		const uint8_t* src = next_glyph(input, font, &width);
+		uint8_t gap = glyph_spacing(chr, *input, font);
+		rendered += put_columns(x, src, width);
+		rendered += put_columns(x + width, NULL, gap);
+		x += width + gap;
 	}
+	return rendered;
 }
 
 /**************************************************************************/
 /*!
-    @brief	Writes a char to the Pixies at a specified position.
+    @brief	Returns the number of columns **input** takes in a proportional
+	font, including the spacing after the last glyph.
+*/
+/**************************************************************************/
+uint16_t Pixie::text_width(char* input, const PixieFont& font){
+	uint16_t width = 0;
+	while(*input != 0){
+		uint8_t w;
+		char chr = *input;
+		next_glyph(input, font, &w);
+		width += w + glyph_spacing(chr, *input, font);
+	}
+	return width;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Combines a column bitmap (one byte per column, bit 0 at the top)
+	with the display buffer at (**x**,**y**), clipped to the chain/canvas.
 	
-    @param	chr		char to write
-	@param	pos     Position in the chain to start writing
+    @param	bitmap	Columns to draw
+	@param	width	Number of columns in **bitmap**
+	@param	x		Column of the bitmap's left edge, can be negative
+	@param	y		Rows to move the bitmap down (negative moves it up)
+	@param	op		PIX_OP_COPY, PIX_OP_OR, PIX_OP_AND, PIX_OP_XOR or PIX_OP_ANDNOT
 */
 /**************************************************************************/
-void Pixie::write_char(char chr, uint8_t pos) {
-	if(pix_type == PRO){
-		if(pos < disp_count){	
-			if (chr >= 32) {
-				chr -= 32;
-			}
-			
-			uint8_t offset = 0;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 5;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(PIX_WRITE,  0+(13*pos_even)); // command, command data, 7-bit brightness
-			write_byte(0,          1+(13*pos_even));
-			write_byte(bright,     2+(13*pos_even));
+void Pixie::blit(const uint8_t* bitmap, uint16_t width, int16_t x, int8_t y, uint8_t op){
+	if(y <= -7 || y >= 7){
+		return;
+	}
+	uint8_t mask = 0x7F; // Rows of the display the bitmap covers
+	if(y >= 0){
+		mask = (mask << y) & 0x7F;
+	}
+	else{
+		mask >>= -y;
+	}
+	
+	uint16_t first = 0;
+	if(x < 0){
+		first = -x;
+	}
+	int32_t x_end = (int32_t)x + width;
+	if(x_end > frame_cols){
+		x_end = frame_cols;
+	}
+	if((int32_t)x + first >= x_end){
+		return;
+	}
+	
+	uint16_t i = frame_index(x + first);
+	for(uint16_t c = first; c < x_end - x; c++){
+		uint8_t v = bitmap[c];
+		if(y >= 0){
+			v = (v << y) & mask;
+		}
+		else{
+			v = (v >> -y) & mask;
+		}
+		
+		uint8_t& dst = frame[i];
+		if(op == PIX_OP_COPY){
+			dst = (dst & ~mask) | v;
+		}
+		else if(op == PIX_OP_OR){
+			dst |= v;
+		}
+		else if(op == PIX_OP_AND){
+			dst &= v | ~mask;
+		}
+		else if(op == PIX_OP_XOR){
+			dst ^= v;
+		}
+		else if(op == PIX_OP_ANDNOT){
+			dst &= ~v;
+		}
+		
+		if(++i == frame_cols){
+			i = 0;
+		}
+	}
+}
 
-			write_byte(pgm_read_byte(col+(chr * 5 + 0)),  3+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 1)),  4+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 2)),  5+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 3)),  6+(13*pos_even)+offset);			
-			write_byte(pgm_read_byte(col+(chr * 5 + 4)),  7+(13*pos_even)+offset);
+/**************************************************************************/
+/*!
+    @brief	Draws asset **id** of a packed set like blit() above, decoding
+	it straight from PROGMEM. Columns left of the buffer are skipped
+	without decoding (PIX_PACK7), and decoding stops at the right edge.
+	
+    @param	set		Asset set, such as PIX_ICONS from Pixie_Icon_Pack_P.h
+	@param	id		Asset to draw, such as PIX_ICON_ARROW_UP
+	@param	x		Column of the asset's left edge, can be negative
+	@param	y		Rows to move the asset down (negative moves it up)
+	@param	op		PIX_OP_COPY, PIX_OP_OR, PIX_OP_AND, PIX_OP_XOR or PIX_OP_ANDNOT
+*/
+/**************************************************************************/
+void Pixie::blit(const PixieAssets& set, uint16_t id, int16_t x, int8_t y, uint8_t op){
+	if(id >= set.count){
+		return;
+	}
+	AssetReader reader(set, id);
+	uint16_t first = 0;
+	if(x < 0){
+		first = -x;
+		if(first >= set.width){
+			return;
 		}
-		set_cursor(pos+1);
+		reader.skip(first);
 	}
-	else{
-		if(pos < disp_count){		
-			if (chr >= 32) {
-				chr -= 32;
-			}
-			
-			write_byte(0,      8*pos+0);
-			write_byte(bright, 8*pos+1);
-			write_byte(0,      8*pos+2);
-			write_byte(pgm_read_byte(col+(chr * 5 + 0)),  8*pos+3);
-			write_byte(pgm_read_byte(col+(chr * 5 + 1)),  8*pos+4);
-			write_byte(pgm_read_byte(col+(chr * 5 + 2)),  8*pos+5);
-			write_byte(pgm_read_byte(col+(chr * 5 + 3)),  8*pos+6);
-			write_byte(pgm_read_byte(col+(chr * 5 + 4)),  8*pos+7);
-			
-			set_cursor(pos+1);
+	int32_t x_end = (int32_t)x + set.width;
+	if(x_end > frame_cols){
+		x_end = frame_cols;
+	}
+	
+	uint8_t buf[8];
+	for(int32_t c = (int32_t)x + first; c < x_end; ){
+		uint8_t n = 0;
+		while(n < sizeof(buf) && c + n < x_end){
+			buf[n++] = reader.next();
 		}
+		blit(buf, n, c, y, op);
+		c += n;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Decodes asset **id** of a packed set into **out**, which must
+	hold at least set.width bytes.
+	
+    @return	Number of columns decoded, 0 if **id** is not in the set
+*/
+/**************************************************************************/
+uint8_t Pixie::unpack(const PixieAssets& set, uint16_t id, uint8_t* out){
+	if(id >= set.count){
+		return 0;
+	}
+	AssetReader reader(set, id);
+	for(uint8_t c = 0; c < set.width; c++){
+		out[c] = reader.next();
+	}
+	return set.width;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Writes asset **id** of a packed set to the Pixies at a specified position.
+	
+    @param	set		Asset set, such as PIX_ICONS from Pixie_Icon_Pack_P.h
+	@param	id		Asset to write, such as PIX_ICON_ARROW_UP
+	@param	pos     Position in the chain to start writing
+*/
+/**************************************************************************/
+void Pixie::write(const PixieAssets& set, uint16_t id, uint8_t pos){
+	if(pos < frame_cols/5){
+		blit(set, id, pos*5, 0, PIX_OP_COPY);
+	}
+	set_cursor(pos + (set.width+4)/5);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Writes a char to the Pixies at a specified position.
+	
+    @param	chr		char to write
+	@param	pos     Position in the chain to start writing
+*/
+/**************************************************************************/
+void Pixie::write_char(char chr, uint8_t pos) {
+	if(pos < frame_cols/5){
+		copy_columns_P(pos*5, glyph(chr), 5);
 	}
+	set_cursor(pos+1);
 }
 
 void Pixie::print(float input, uint8_t places){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];	
-	sprintf(char_buf, "%.*f", places, input);
-	write(char_buf, pos);
+	write_number(number(input, places), cursor_pos);
 }
 
 void Pixie::print(double input, uint8_t places){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];	
-	sprintf(char_buf, "%.*f", places, input);
-	write(char_buf, pos);
+	write_number(number(input, places), cursor_pos);
 }
 
 void Pixie::print(int16_t input){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];
-	itoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((int32_t)input), cursor_pos);
 }
 
 void Pixie::print(uint16_t input){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];
-	utoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((uint32_t)input), cursor_pos);
 }
 
 void Pixie::print(int32_t input){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];
-	ltoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((int32_t)input), cursor_pos);
 }
 
 void Pixie::print(uint32_t input){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	char char_buf[48];
-	ultoa(input,char_buf,10);
-	write(char_buf, pos);
+	write_number(number((uint32_t)input), cursor_pos);
 }
 
 #if defined(ESP8266) || defined(ESP32)
 	void Pixie::print(long unsigned int input){
-		uint8_t pos = cursor_pos;
-		cursor_pos++;
-		char char_buf[48];
-		ultoa(input,char_buf,10);
-		write(char_buf, pos);
+		write_number(number((uint32_t)input), cursor_pos);
 	}
 #endif
 
@@ -625,239 +1436,356 @@ void Pixie::print(char input){
 }
 
 void Pixie::print(uint8_t* icon) {
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	if(pos < disp_count){
-		if(pix_type == PRO){
-			uint8_t offset = 0;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 5;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(0, 2+(13*pos_even)); // command, data, brightness
-			write_byte(0, 1+(13*pos_even));
-			write_byte(0, 0+(13*pos_even));
-			
-			write_byte(icon[4], 7+(13*pos_even)+offset);
-			write_byte(icon[3], 6+(13*pos_even)+offset);
-			write_byte(icon[2], 5+(13*pos_even)+offset);
-			write_byte(icon[1], 4+(13*pos_even)+offset);
-			write_byte(icon[0], 3+(13*pos_even)+offset);
-		}
-		else{
-			display_buffer[8*pos+0] = 0;
-			display_buffer[8*pos+1] = bright;
-			display_buffer[8*pos+2] = 0;
-			
-			display_buffer[8*pos+3] = icon[0];
-			display_buffer[8*pos+4] = icon[1];
-			display_buffer[8*pos+5] = icon[2];
-			display_buffer[8*pos+6] = icon[3];
-			display_buffer[8*pos+7] = icon[4];
-		}
-	}
+	write(icon[0], icon[1], icon[2], icon[3], icon[4], cursor_pos);
 }
 
 void Pixie::print(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5){
-	uint8_t pos = cursor_pos;
-	cursor_pos++;
-	if(pos < disp_count){
-		if(pix_type == PRO){			
-			uint8_t offset = 0;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 5;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(0, 2+(13*pos_even)); // command, data, brightness
-			write_byte(0, 1+(13*pos_even));
-			write_byte(0, 0+(13*pos_even));
-			
-			write_byte(byte5, 7+(13*pos_even)+offset);
-			write_byte(byte4, 6+(13*pos_even)+offset);
-			write_byte(byte3, 5+(13*pos_even)+offset);
-			write_byte(byte2, 4+(13*pos_even)+offset);
-			write_byte(byte1, 3+(13*pos_even)+offset);
-		}
-		else{
-			display_buffer[8*pos+0] = 0;
-			display_buffer[8*pos+1] = bright;
-			display_buffer[8*pos+2] = 0;
-			
-			display_buffer[8*pos+3] = byte1;
-			display_buffer[8*pos+4] = byte2;
-			display_buffer[8*pos+5] = byte3;
-			display_buffer[8*pos+6] = byte4;
-			display_buffer[8*pos+7] = byte5;
-		}
-	}
+	write(byte1, byte2, byte3, byte4, byte5, cursor_pos);
+}
+
+void Pixie::print(const PixieAssets& set, uint16_t id){
+	write(set, id, cursor_pos);
 }
 
 void Pixie::print(char* input){
-	uint8_t pos = cursor_pos;
-	uint8_t len = strlen(input);
-	if(len > disp_count-pos){
-		len = disp_count-pos;
-	}
-	for(uint8_t i = 0; i < len; i++){
-		print_char(input[i]);
-	}
+	write(input, cursor_pos);
 }
 
 void Pixie::print_char(char chr) {
-	if(pix_type == PRO){
-		uint8_t pos = cursor_pos;
-		cursor_pos++;
-		if(pos < disp_count){		
-			if (chr >= 32) {
-				chr -= 32;
-			}
-			
-			uint8_t offset = 0;			
-			uint8_t pos_even = pos;
-			if(bitRead(pos_even,0) == 1){
-				offset = 5;
-				bitWrite(pos_even,0,0);
-			}
-			pos_even = pos_even >> 1;
-			
-			write_byte(0,  2+(13*pos_even)); // command, data, brightness
-			write_byte(0,  1+(13*pos_even));
-			write_byte(0,  0+(13*pos_even));
-			
-			write_byte(pgm_read_byte(col+(chr * 5 + 4)),  7+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 3)),  6+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 2)),  5+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 1)),  4+(13*pos_even)+offset);
-			write_byte(pgm_read_byte(col+(chr * 5 + 0)),  3+(13*pos_even)+offset);
+	write_char(chr, cursor_pos);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Replaces the display buffer with an off-screen canvas **width**
+	columns wide (at least the width of the chain). Everything draws into
+	the canvas, and show() sends the part of it under the viewport. A
+	PixieFixed canvas can't be wider than its CANVAS parameter.
+	
+    @param	width	Canvas width in columns (5 per display position)
+*/
+/**************************************************************************/
+void Pixie::canvas(uint16_t width){
+	if(width < disp_count*5){
+		width = disp_count*5;
+	}
+	if(frame_size != 0){ // Static storage can't grow
+		if(width > frame_size){
+			width = frame_size;
 		}
 	}
 	else{
-		uint8_t pos = cursor_pos;
-		cursor_pos++;
-		if(pos < disp_count){		
-			if (chr >= 32) {
-				chr -= 32;
-			}
-			
-			write_byte(0,      8*pos+0);
-			write_byte(bright, 8*pos+1);
-			write_byte(0,      8*pos+2);
-			write_byte(pgm_read_byte(col+(chr * 5 + 0)),  8*pos+3);
-			write_byte(pgm_read_byte(col+(chr * 5 + 1)),  8*pos+4);
-			write_byte(pgm_read_byte(col+(chr * 5 + 2)),  8*pos+5);
-			write_byte(pgm_read_byte(col+(chr * 5 + 3)),  8*pos+6);
-			write_byte(pgm_read_byte(col+(chr * 5 + 4)),  8*pos+7);
-		}
+		delete[] frame;
+		frame = new uint8_t[width];
 	}
+	frame_cols = width;
+	clear();
+	view_x = 0;
 }
 
-void Pixie::set_cursor(uint8_t pos){
-	cursor_pos = pos;
-}
-
-void Pixie::write_brightness(uint8_t br, uint8_t pos) {
-	if(pix_type == PRO){
-		write_byte(PIX_WRITE, 0+(13*pos)); // command, command data, 7-bit brightness
-		write_byte(0,         1+(13*pos));
-		write_byte(br,        2+(13*pos));
-		show(false);
-	}
-	else{
-		bitWrite(br,7,1); // set bit 7 (MSB) to 1 to signify PWM byte to PIXIE
-		if(pos < disp_count){		
-			write_byte(0,      8*pos+0);
-			write_byte(br,     8*pos+1);
-			write_byte(0,      8*pos+2);
+/**************************************************************************/
+/*!
+    @brief	Moves the viewport so that canvas column **x** is at the left
+	edge of the chain. In PIX_WRAP mode the canvas repeats endlessly, in
+	PIX_CLAMP mode the viewport stops at the canvas edges.
+	
+    @param	x	Canvas column, can be negative
+	@return	True if the viewport had to be clamped (an edge was hit)
+*/
+/**************************************************************************/
+bool Pixie::set_view(int32_t x){
+	if(view_mode == PIX_WRAP){
+		x %= frame_cols;
+		if(x < 0){
+			x += frame_cols;
 		}
+		view_x = x;
+		return false;
 	}
+	
+	int32_t x_max = frame_cols - disp_count*5;
+	bool hit = false;
+	if(x < 0){
+		x = 0;
+		hit = true;
+	}
+	else if(x > x_max){
+		x = x_max;
+		hit = true;
+	}
+	view_x = x;
+	return hit;
 }
 
-void Pixie::write_byte(uint8_t col, uint16_t pos) {
-	display_buffer[pos] = col;
+/**************************************************************************/
+/*!
+    @brief	Moves the viewport by **dx** columns, see set_view()
+*/
+/**************************************************************************/
+bool Pixie::move_view(int16_t dx){
+	return set_view((int32_t)view_x + dx);
 }
 
-void Pixie::push(float input, uint8_t places){
-	char char_buf[48];
-	sprintf(char_buf, "%.*f", places, input);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
-		}
-		push_char(char_buf[i]);
-	}
+/**************************************************************************/
+/*!
+    @brief	Returns the canvas column at the left edge of the chain
+*/
+/**************************************************************************/
+uint16_t Pixie::get_view(){
+	return view_x;
 }
 
-void Pixie::push(double input, uint8_t places){
-	char char_buf[48];
-	sprintf(char_buf, "%.*f", places, input);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
-		}
-		push_char(char_buf[i]);
-	}
+/**************************************************************************/
+/*!
+    @brief	Returns the width of the canvas in columns, the chain's width
+	without canvas()
+*/
+/**************************************************************************/
+uint16_t Pixie::canvas_width(){
+	return frame_cols;
 }
 
-void Pixie::push(int16_t input){
-	char char_buf[48];
-	itoa(input,char_buf,10);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
-		}
-		push_char(char_buf[i]);
-	}
+/**************************************************************************/
+/*!
+    @brief	Sets how the viewport treats the canvas edges: PIX_CLAMP (default) or PIX_WRAP
+*/
+/**************************************************************************/
+void Pixie::set_view_mode(uint8_t mode){
+	view_mode = mode;
+	set_view(view_x);
 }
 
-void Pixie::push(uint16_t input){
-	char char_buf[48];
-	utoa(input,char_buf,10);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
-		}
-		push_char(char_buf[i]);
-	}
+/**************************************************************************/
+/*!
+    @brief	Sets how the chain is mounted: PIX_NORMAL (default), PIX_MIRROR_X
+	(left and right swapped), PIX_MIRROR_Y (upside down letters, same order)
+	or PIX_ROTATE_180 (both, for a chain mounted upside down). Drawing is
+	unchanged, encoding the next show() applies it. The brightness map
+	keeps counting modules along the wire.
+*/
+/**************************************************************************/
+void Pixie::set_orientation(uint8_t mode){
+	orientation = mode & PIX_ROTATE_180;
+	mark_modules(0, pixie_count-1);
 }
 
-void Pixie::push(int32_t input){
-	char char_buf[48];
-	ltoa(input,char_buf,10);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
-		}
-		push_char(char_buf[i]);
-	}
+/**************************************************************************/
+/*!
+    @brief	Returns the orientation from set_orientation()
+*/
+/**************************************************************************/
+uint8_t Pixie::get_orientation(){
+	return orientation;
 }
 
-void Pixie::push(uint32_t input){
-	char char_buf[48];
-	ultoa(input,char_buf,10);
-	for(uint8_t i = 0; i < 48; i++){
-		if(char_buf[i] == 0){
-			break;
+/**************************************************************************/
+/*!
+    @brief	Shows everything rotated by 180 degrees if **flip** is true, for
+	a chain mounted upside down. Same as set_orientation(PIX_ROTATE_180).
+*/
+/**************************************************************************/
+void Pixie::flipped(bool flip){
+	set_orientation(flip ? PIX_ROTATE_180 : PIX_NORMAL);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the attributes of display position **pos**: any of PIX_BLINK,
+	PIX_INVERT, PIX_UNDERLINE and PIX_DIM, or 0 for none. They belong to
+	the position on the chain, not to what is drawn there, and are applied
+	while encoding: the display buffer is never touched, so text can be
+	redrawn without losing them and they cost nothing to change. Only the
+	module showing **pos** is marked for show_changes().
+*/
+/**************************************************************************/
+void Pixie::set_attribute(uint8_t pos, uint8_t attr){
+	if(pos >= disp_count){
+		return;
+	}
+	attr &= PIX_BLINK | PIX_INVERT | PIX_UNDERLINE | PIX_DIM;
+	if(attr == attributes[pos]){
+		return;
+	}
+	if(attributes[pos] == 0){
+		attr_count++;
+	}
+	else if(attr == 0){
+		attr_count--;
+	}
+	attributes[pos] = attr;
+	mark_position(pos);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the attributes of display position **pos**
+*/
+/**************************************************************************/
+uint8_t Pixie::get_attribute(uint8_t pos){
+	if(pos >= disp_count){
+		return 0;
+	}
+	return attributes[pos];
+}
+
+/**************************************************************************/
+/*!
+    @brief	Takes the attributes off every display position. clear() leaves
+	them in place.
+*/
+/**************************************************************************/
+void Pixie::clear_attributes(){
+	for(uint8_t i = 0; i < disp_count; i++){
+		set_attribute(i, 0);
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the blink phase shared by every PIX_BLINK position: shown
+	if **on**, blank if not. Only the modules with blinking positions are
+	marked for show_changes(), the rest of the chain isn't encoded again.
+*/
+/**************************************************************************/
+void Pixie::set_blink_phase(bool on){
+	if(on == blink_on){
+		return;
+	}
+	blink_on = on;
+	if(attr_count == 0){
+		return;
+	}
+	for(uint8_t i = 0; i < disp_count; i++){
+		if(attributes[i] & PIX_BLINK){
+			mark_position(i);
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves the blink phase on from millis(): **ms** shown, then **ms**
+	blank. Call it from loop() and follow it with show_changes().
+	
+    @return	True if a blinking position changed
+*/
+/**************************************************************************/
+bool Pixie::update_blink(uint16_t ms){
+	if(ms == 0){
+		ms = 1;
+	}
+	bool on = (millis() / ms) % 2 == 0;
+	if(on == blink_on){
+		return false;
+	}
+	set_blink_phase(on);
+	for(uint8_t i = 0; i < disp_count; i++){
+		if(attributes[i] & PIX_BLINK){
+			return true;
+		}
+	}
+	return false;
+}
+
+// Marks the module showing display position **pos**
+void Pixie::mark_position(uint8_t pos){
+	if(orientation & PIX_MIRROR_X){ // Modules are counted along the wire
+		pos = disp_count-1 - pos;
+	}
+	mark_modules(pos / 2, pos / 2);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of display positions in the chain (two per Pixie)
+*/
+/**************************************************************************/
+uint8_t Pixie::display_count(){
+	return disp_count;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of Pixie modules in the chain
+*/
+/**************************************************************************/
+uint8_t Pixie::module_count(){
+	return pixie_count;
+}
+
+void Pixie::set_cursor(uint8_t pos){
+	cursor_pos = pos;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the brightness of one position. PRO sends it right away with
+	show(), so use set_brightness() to change several modules in one frame.
+	LEGACY positions are displays (the module reads the even one's level),
+	and nothing is sent until show().
+*/
+/**************************************************************************/
+void Pixie::write_brightness(uint8_t br, uint8_t pos) {
+	if(pix_type == PRO){
+		set_brightness(br, pos);
+		show();
+	}
+	else{
+		bitWrite(br,7,1); // set bit 7 (MSB) to 1 to signify PWM byte to PIXIE
+		if(pos < disp_count){		
+			display_buffer[8*pos+0] = 0;
+			display_buffer[8*pos+1] = br;
+			display_buffer[8*pos+2] = 0;
 		}
-		push_char(char_buf[i]);
 	}
 }
 
+void Pixie::write_byte(uint8_t col, uint16_t pos) {
+	if(pos < frame_cols){
+		frame[frame_index(pos)] = col;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns column **pos** of the display buffer (bit 0 at the top),
+	0 past its end
+*/
+/**************************************************************************/
+uint8_t Pixie::read_byte(uint16_t pos){
+	if(pos < frame_cols){
+		return frame[frame_index(pos)];
+	}
+	return 0;
+}
+
+void Pixie::push(float input, uint8_t places){
+	push_number(number(input, places));
+}
+
+void Pixie::push(double input, uint8_t places){
+	push_number(number(input, places));
+}
+
+void Pixie::push(int16_t input){
+	push_number(number((int32_t)input));
+}
+
+void Pixie::push(uint16_t input){
+	push_number(number((uint32_t)input));
+}
+
+void Pixie::push(int32_t input){
+	push_number(number((int32_t)input));
+}
+
+void Pixie::push(uint32_t input){
+	push_number(number((uint32_t)input));
+}
+
 #if defined(ESP8266) || defined(ESP32)
 	void Pixie::push(long unsigned int input){
-		char char_buf[48];
-		ultoa(input,char_buf,10);
-		for(uint8_t i = 0; i < 48; i++){
-			if(char_buf[i] == 0){
-				break;
-			}
-			push_char(char_buf[i]);
-		}
+		push_number(number((uint32_t)input));
 	}
 #endif
 
@@ -866,174 +1794,92 @@ void Pixie::push(char input){
 }
 
 void Pixie::push(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5){
-	if(pix_type == PRO){
-		push_byte(byte1);
-		push_byte(byte2);
-		push_byte(byte3);
-		push_byte(byte4);
-		push_byte(byte5);
-	}
-	else{
-		push_byte(0);
-		push_byte(bright);
-		push_byte(0);
-		push_byte(byte1);
-		push_byte(byte2);
-		push_byte(byte3);
-		push_byte(byte4);
-		push_byte(byte5);
-	}
+	push_byte(byte1);
+	push_byte(byte2);
+	push_byte(byte3);
+	push_byte(byte4);
+	push_byte(byte5);
 }
 
 void Pixie::push(uint8_t* icon){
-	if(pix_type == PRO){
-		push_byte(icon[0]);
-		push_byte(icon[1]);
-		push_byte(icon[2]);
-		push_byte(icon[3]);
-		push_byte(icon[4]);
+	push(icon[0], icon[1], icon[2], icon[3], icon[4]);
+}
+
+void Pixie::push(const PixieAssets& set, uint16_t id){
+	if(id >= set.count){ // Nothing to show, so nothing moves
+		return;
 	}
-	else{
-		push_byte(0);
-		push_byte(bright);
-		push_byte(0);
-		push_byte(icon[0]);
-		push_byte(icon[1]);
-		push_byte(icon[2]);
-		push_byte(icon[3]);
-		push_byte(icon[4]);
+	if(set.width < frame_cols){
+		frame_head = frame_index(set.width);
 	}
+	blit(set, id, frame_cols - set.width);
 }
 
 void Pixie::push(char* input){
-	uint8_t len = strlen(input);
-	for(uint8_t i = 0; i < len; i++){
-		push_char(input[i]);
+	uint16_t width = text_length(input)*5;
+	if(width >= frame_cols){ // Only the tail of the string stays visible
+		draw_text(input, frame_cols/5*5 - width);
+		return;
 	}
+	frame_head = frame_index(width);
+	draw_text(input, frame_cols-width);
 }
 
-void Pixie::push_byte(uint8_t col) {
-	if(pix_type == PRO){
-		for(uint8_t i = 0; i < pixie_count; i++){
-			uint8_t i_next = i+1;
-			if(i_next >= pixie_count){
-				i_next = pixie_count-1;
-			}
-			display_buffer[i*13+3] = display_buffer[(i+0)*13+4];
-			display_buffer[i*13+4] = display_buffer[(i+0)*13+5];
-			display_buffer[i*13+5] = display_buffer[(i+0)*13+6];
-			display_buffer[i*13+6] = display_buffer[(i+0)*13+7];
-			display_buffer[i*13+7] = display_buffer[(i+0)*13+8];
-	
-			display_buffer[i*13+8] = display_buffer[(i+0)*13+9];
-			display_buffer[i*13+9] = display_buffer[(i+0)*13+10];
-			display_buffer[i*13+10] = display_buffer[(i+0)*13+11];
-			display_buffer[i*13+11] = display_buffer[(i+0)*13+12];
-			display_buffer[i*13+12] = display_buffer[(i_next)*13+3];
-		}
-		uint16_t len = pixie_count * 13;
-		display_buffer[len - 1] = col;
-		
+/**************************************************************************/
+/*!
+    @brief	Pushes a string in from the right in a proportional font. Only
+	the columns each glyph needs are pushed, see draw_text().
+*/
+/**************************************************************************/
+void Pixie::push(char* input, const PixieFont& font){
+	uint16_t width = text_width(input, font);
+	if(width >= frame_cols){ // Only the tail of the string stays visible
+		draw_text(input, frame_cols - width, font);
+		return;
 	}
-	else{
-		uint16_t len = disp_count * 8;
+	frame_head = frame_index(width);
+	draw_text(input, frame_cols-width, font);
+}
 
-		for (int16_t i = 0; i < len - 1; i++) {
-			display_buffer[i] = display_buffer[i + 1];
-		}
-		display_buffer[len - 1] = col;
-	}
+void Pixie::push_byte(uint8_t col) {
+	frame[frame_head] = col; // Old leftmost column becomes the new rightmost
+	frame_head = frame_index(1);
 }
 
 void Pixie::push_char(char chr) {
-	if(pix_type == PRO){
-		if (chr >= 32) {
-			chr -= 32;
-		}
-		push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 4)));
-	}
-	else{
-		if (chr >= 32) {
-			chr -= 32;
-		}
-
-		push_byte(0);
-		push_byte(bright);
-		push_byte(0);
-		push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-		push_byte(pgm_read_byte(col+(chr * 5 + 4)));		
+	const uint8_t* src = glyph(chr);
+	for(uint8_t i = 0; i < 5; i++){
+		push_byte(pgm_read_byte(src+i));
 	}
 }
 
 void Pixie::shift(float input, uint8_t places){
-	const uint8_t len = get_length((float)input, places);
-	char char_buf[len];
-	sprintf(char_buf, "%.*f", places, input);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number(input, places));
 }
 
 void Pixie::shift(double input, uint8_t places){
-	const uint8_t len = get_length((float)input, places);
-	char char_buf[len];
-	sprintf(char_buf, "%.*f", places, input);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number(input, places));
 }
 
 void Pixie::shift(int16_t input){
-	const uint8_t len = get_length((int32_t)input);
-	char char_buf[len];
-	itoa(input,char_buf,10);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number((int32_t)input));
 }
 
 void Pixie::shift(uint16_t input){
-	const uint8_t len = get_length((int32_t)input);
-	char char_buf[len];
-	utoa(input,char_buf,10);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number((uint32_t)input));
 }
 
 void Pixie::shift(int32_t input){
-	const uint8_t len = get_length((int32_t)input);
-	char char_buf[len];
-	ltoa(input,char_buf,10);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number((int32_t)input));
 }
 
 void Pixie::shift(uint32_t input){
-	const uint8_t len = get_length(input);
-	char char_buf[len];
-	ultoa(input,char_buf,10);
-	for(uint8_t i = 0; i < len; i++){
-		shift_char(char_buf[len-1-i]);
-	}
+	shift_number(number((uint32_t)input));
 }
 
 #if defined(ESP8266) || defined(ESP32)
 	void Pixie::shift(long unsigned int input){
-		const uint8_t len = get_length(input);
-		char char_buf[len];
-		ultoa(input,char_buf,10);
-		for(uint8_t i = 0; i < len; i++){
-			shift_char(char_buf[len-1-i]);
-		}
+		shift_number(number((uint32_t)input));
 	}
 #endif
 
@@ -1042,241 +1888,421 @@ void Pixie::shift(char input){
 }
 
 void Pixie::shift(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5){
-	if(pix_type == PRO){
-		shift_byte(byte5);
-		shift_byte(byte4);
-		shift_byte(byte3);
-		shift_byte(byte2);
-		shift_byte(byte1);
-	}
-	else{
-		shift_byte(byte5);
-		shift_byte(byte4);
-		shift_byte(byte3);
-		shift_byte(byte2);
-		shift_byte(byte1);
-		shift_byte(0);
-		shift_byte(bright);
-		shift_byte(0);
-	}
+	shift_byte(byte5);
+	shift_byte(byte4);
+	shift_byte(byte3);
+	shift_byte(byte2);
+	shift_byte(byte1);
 }
 
 void Pixie::shift(uint8_t* icon){
-	if(pix_type == PRO){
-		shift_byte(icon[4]);
-		shift_byte(icon[3]);
-		shift_byte(icon[2]);
-		shift_byte(icon[1]);
-		shift_byte(icon[0]);
+	shift(icon[0], icon[1], icon[2], icon[3], icon[4]);
+}
+
+void Pixie::shift(const PixieAssets& set, uint16_t id){
+	if(id >= set.count){ // Nothing to show, so nothing moves
+		return;
 	}
-	else{
-		shift_byte(icon[4]);
-		shift_byte(icon[3]);
-		shift_byte(icon[2]);
-		shift_byte(icon[1]);
-		shift_byte(icon[0]);
-		shift_byte(0);
-		shift_byte(bright);
-		shift_byte(0);
+	if(set.width < frame_cols){
+		frame_head = frame_index(frame_cols - set.width);
 	}
+	blit(set, id, 0);
 }
 
 void Pixie::shift(char* input){
-	uint8_t len = strlen(input);
-	for(int16_t i = len-1; i >= 0; i--){
-		shift_char(input[i]);
+	uint16_t width = text_length(input)*5;
+	if(width < frame_cols){
+		frame_head = frame_index(frame_cols-width);
+	}
+	draw_text(input, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Shifts a string in from the left in a proportional font, see push()
+*/
+/**************************************************************************/
+void Pixie::shift(char* input, const PixieFont& font){
+	uint16_t width = text_width(input, font);
+	if(width < frame_cols){
+		frame_head = frame_index(frame_cols-width);
 	}
+	draw_text(input, 0, font);
 }
 
 void Pixie::shift_byte(uint8_t col) {
-	if(pix_type == PRO){
-		for(uint8_t i = 0; i < pixie_count; i++){
-			uint8_t i_inv = pixie_count-1-i;
+	frame_head = frame_index(frame_cols-1); // Rightmost column becomes the new leftmost
+	frame[frame_head] = col;
+}
 
-			uint8_t i_next = i_inv-1;
-			if(i_next <= 0){
-				i_next = 0;
+void Pixie::shift_char(char chr) {
+	const uint8_t* src = glyph(chr);
+	for(int8_t i = 4; i >= 0; i--){
+		shift_byte(pgm_read_byte(src+i));
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws a line from (**x1**,**y1**) to (**x2**,**y2**). Shallow
+	lines are drawn as one span per row they cross, steeper lines as one
+	row mask per column, instead of one set_pix() per point.
+*/
+/**************************************************************************/
+void Pixie::draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t state){
+	//Bresenham's line algorithm
+	int16_t dx = abs(x2-x1);
+	int16_t dy = -abs(y2-y1);
+	int8_t sx = (x1 < x2) ? 1 : -1;
+	int8_t sy = (y1 < y2) ? 1 : -1;
+	int16_t err = dx+dy;
+	
+	if(dx >= -2*dy){ // Rows at least two columns long on average
+		int16_t run = x1; // First column of the current row
+		while(x1 != x2 || y1 != y2){
+			int16_t e2 = 2*err;
+			int16_t x_last = x1;
+			if(e2 >= dy){
+				err += dy;
+				x1 += sx;
 			}
-			
-			display_buffer[i_inv*13+12] = display_buffer[i_inv*13+11];
-			display_buffer[i_inv*13+11] = display_buffer[i_inv*13+10];
-			display_buffer[i_inv*13+10] = display_buffer[i_inv*13+9];
-			display_buffer[i_inv*13+9]  = display_buffer[i_inv*13+8];
-			display_buffer[i_inv*13+8]  = display_buffer[i_inv*13+7];
-			display_buffer[i_inv*13+7]  = display_buffer[i_inv*13+6];
-			display_buffer[i_inv*13+6]  = display_buffer[i_inv*13+5];
-			display_buffer[i_inv*13+5]  = display_buffer[i_inv*13+4];
-			display_buffer[i_inv*13+4]  = display_buffer[i_inv*13+3];
-			display_buffer[i_inv*13+3]  = display_buffer[i_next*13+12];
-		}
-		uint16_t len = pixie_count * 13;
-		display_buffer[3] = col;
-		
+			if(e2 <= dx){ // Leaving this row
+				row_run(run, x_last, y1, state);
+				err += dx;
+				y1 += sy;
+				run = x1;
+			}
+		}
+		row_run(run, x1, y1, state);
 	}
-	else{		
-		uint16_t len = disp_count * 8;
-		
-		for (uint16_t i = len-1; i > 0; i--) {
-			display_buffer[i] = display_buffer[i - 1];
+	else{
+		uint8_t mask = 0;
+		while(true){
+			if(y1 >= 0 && y1 < 7){
+				mask |= 1 << y1;
+			}
+			if(x1 == x2 && y1 == y2){
+				break;
+			}
+			int16_t e2 = 2*err;
+			if(e2 >= dy){
+				mask_column(x1, mask, state); // Leaving this column
+				mask = 0;
+				err += dy;
+				x1 += sx;
+			}
+			if(e2 <= dx){
+				err += dx;
+				y1 += sy;
+			}
 		}
+		mask_column(x1, mask, state);
 	}
 }
 
-void Pixie::shift_char(char chr) {
-	if(pix_type == PRO){
-		if (chr >= 32) {
-			chr -= 32;
-		}
-		shift_byte(pgm_read_byte(col+(chr * 5 + 4)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 3)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 2)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 1)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 0)));
+// Draws row **y** from column **xa** to **xb**, in either order
+void Pixie::row_run(int16_t xa, int16_t xb, int16_t y, uint8_t state){
+	if(xa > xb){
+		int16_t t = xa;
+		xa = xb;
+		xb = t;
+	}
+	span(xa, xb-xa+1, row_mask(y, 1), state);
+}
+
+// Sets (state) or clears the **mask** rows of column **x**, if it is in the buffer
+void Pixie::mask_column(int16_t x, uint8_t mask, uint8_t state){
+	if(x < 0 || x >= frame_cols){
+		return;
+	}
+	uint8_t& dst = frame[frame_index(x)];
+	if(state){
+		dst |= mask;
 	}
 	else{
-		if (chr >= 32) {
-			chr -= 32;
-		}
+		dst &= ~mask;
+	}
+}
 
-		shift_byte(pgm_read_byte(col+(chr * 5 + 4)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 3)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 2)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 1)));
-		shift_byte(pgm_read_byte(col+(chr * 5 + 0)));
-		shift_byte(0);
-		shift_byte(bright);
-		shift_byte(0);
+// Mask of rows **y** to **y**+**h**-1, clipped to the 7 display rows
+uint8_t Pixie::row_mask(int16_t y, int16_t h){
+	int16_t y_end = y + h;
+	if(y < 0){
+		y = 0;
+	}
+	if(y_end > 7){
+		y_end = 7;
+	}
+	if(y >= y_end){
+		return 0;
 	}
+	return ((1 << (y_end - y)) - 1) << y;
 }
 
-void Pixie::draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2){
-	//Bresenham's line algorithm
-	uint8_t c = 1;
+// Sets (state) or clears the **mask** rows of **w** columns from **x**, clipped to the buffer
+void Pixie::span(int16_t x, int16_t w, uint8_t mask, uint8_t state){
+	int32_t x_end = (int32_t)x + w;
+	if(x < 0){
+		x = 0;
+	}
+	if(x_end > frame_cols){
+		x_end = frame_cols;
+	}
+	if(mask == 0 || x >= x_end){
+		return;
+	}
 	
-	int16_t x,y,dx,dy,dx1,dy1,px,py,xe,ye,i;
-	dx=x2-x1;
-	dy=y2-y1;
-	dx1=fabs(dx);
-	dy1=fabs(dy);
-	px=2*dy1-dx1;
-	py=2*dx1-dy1;
-	if(dy1<=dx1){
-		if(dx>=0){
-			x=x1;
-			y=y1;
-			xe=x2;
+	uint8_t set = 0; // dst = (dst & keep) | set
+	uint8_t keep = ~mask;
+	if(state){
+		set  = mask;
+		keep = 0xFF;
+	}
+	uint16_t i = frame_index(x);
+	for(int32_t c = x; c < x_end; c++){
+		frame[i] = (frame[i] & keep) | set;
+		if(++i == frame_cols){
+			i = 0;
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws a horizontal line **w** pixels long from (**x**,**y**)
+*/
+/**************************************************************************/
+void Pixie::draw_hline(int16_t x, int16_t y, int16_t w, uint8_t state){
+	span(x, w, row_mask(y, 1), state);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws a vertical line **h** pixels long down from (**x**,**y**)
+*/
+/**************************************************************************/
+void Pixie::draw_vline(int16_t x, int16_t y, int16_t h, uint8_t state){
+	span(x, 1, row_mask(y, h), state);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws the outline of a **w** x **h** rectangle with its top left corner at (**x**,**y**)
+*/
+/**************************************************************************/
+void Pixie::draw_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t state){
+	if(w <= 0 || h <= 0){
+		return;
+	}
+	uint8_t edges = row_mask(y, 1) | row_mask(y+h-1, 1);
+	span(x, 1, row_mask(y, h), state);
+	span(x+1, w-2, edges, state);
+	if(w > 1){
+		span(x+w-1, 1, row_mask(y, h), state);
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fills a **w** x **h** rectangle with its top left corner at (**x**,**y**)
+*/
+/**************************************************************************/
+void Pixie::fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t state){
+	if(w <= 0){
+		return;
+	}
+	span(x, w, row_mask(y, h), state);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws a circle of radius **r** centered on (**x0**,**y0**)
+*/
+/**************************************************************************/
+void Pixie::draw_circle(int16_t x0, int16_t y0, int16_t r, uint8_t state){
+	// Midpoint circle, mirrored into the columns on either side
+	int16_t x = r;
+	int16_t y = 0;
+	int16_t err = 1 - r;
+	while(x >= y){
+		uint8_t near_rows = row_mask(y0-x, 1) | row_mask(y0+x, 1); // Columns x0 +-y
+		uint8_t far_rows  = row_mask(y0-y, 1) | row_mask(y0+y, 1); // Columns x0 +-x
+		mask_column(x0-y, near_rows, state);
+		mask_column(x0+y, near_rows, state);
+		mask_column(x0-x, far_rows, state);
+		mask_column(x0+x, far_rows, state);
+		y++;
+		if(err < 0){
+			err += 2*y + 1;
 		}
 		else{
-			x=x2;
-			y=y2;
-			xe=x1;
-		}
-		set_pix(x,y,c);
-		for(i=0;x<xe;i++){
-			x=x+1;
-			if(px<0){
-				px=px+2*dy1;
-			}
-			else{
-				if((dx<0 && dy<0) || (dx>0 && dy>0)){
-					y=y+1;
-				}
-				else{
-					y=y-1;
-				}
-				px=px+2*(dy1-dx1);
-			}
-			delay(0);
-			set_pix(x,y,c);
+			x--;
+			err += 2*(y - x) + 1;
 		}
 	}
-	else{
-		if(dy>=0){
-			x=x1;
-			y=y1;
-			ye=y2;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fills a circle of radius **r** centered on (**x0**,**y0**)
+*/
+/**************************************************************************/
+void Pixie::fill_circle(int16_t x0, int16_t y0, int16_t r, uint8_t state){
+	int16_t x = r;
+	int16_t y = 0;
+	int16_t err = 1 - r;
+	while(x >= y){
+		uint8_t tall_rows  = row_mask(y0-x, 2*x+1); // Columns x0 +-y
+		uint8_t short_rows = row_mask(y0-y, 2*y+1); // Columns x0 +-x
+		mask_column(x0-y, tall_rows, state);
+		mask_column(x0+y, tall_rows, state);
+		mask_column(x0-x, short_rows, state);
+		mask_column(x0+x, short_rows, state);
+		y++;
+		if(err < 0){
+			err += 2*y + 1;
 		}
 		else{
-			x=x2;
-			y=y2;
-			ye=y1;
-		}
-		set_pix(x,y,c);
-		for(i=0;y<ye;i++){
-			y=y+1;
-			if(py<=0){
-				py=py+2*dx1;
-			}
-			else{
-				if((dx<0 && dy<0) || (dx>0 && dy>0)){
-					x=x+1;
-				}
-				else{
-					x=x-1;
-				}
-				py=py+2*(dx1-dy1);
-			}
-			set_pix(x,y,c);
+			x--;
+			err += 2*(y - x) + 1;
 		}
 	}
 }
 
 uint8_t Pixie::get_length(float input, uint8_t dec){
-	if(input == 0){
-		return 2+dec;
-	}
-	uint8_t places = 1 + dec;
-	if(input < 0){
-		places++; // signed
-	}
-	int32_t input_whole = input;
-	while(abs(int32_t(input)) >= 1){
-		input /= 10;
-		places++;
+	PixieNumber n = number(input, dec);
+	if(n.text != NULL){
+		return 3 + n.negative;
 	}
-	return places;
+	return n.negative + count_digits(n.whole) + n.places + (n.places != 0);
 }
 
 uint8_t Pixie::get_length(int32_t input){
-	if(input == 0){
-		return 1;
-	}
-	uint8_t places = 0;
-	if(input < 0){
-		places++; // signed
+	return (input < 0) + count_digits(number(input).whole);
+}
+
+uint8_t Pixie::get_length(uint32_t input){
+	return count_digits(input);
+}
+
+#if defined(ESP8266) || defined(ESP32)
+	uint8_t Pixie::get_length(long unsigned int input){
+		return count_digits(input);
 	}
-	while(abs(int32_t(input)) >= 1){
-		input /= 10;
-		places++;
+#endif
+
+/**************************************************************************/
+/*!
+    @brief	Sets how numbers are written, printed, pushed and shifted from
+	now on. Numbers shorter than **width** positions are padded, and a
+	'0' pad goes between the sign and the digits. Zeros after the digits
+	would read as a different number, so left aligned numbers are padded
+	with spaces whatever **pad** is, and so are nan, inf and ovf. Width 0
+	(the default) turns padding off.
+	
+    @param	width	Minimum number of positions, 0 for no padding
+	@param	pad		Character to pad with, such as ' ' or '0'
+	@param	align	PIX_ALIGN_RIGHT (pad on the left) or PIX_ALIGN_LEFT
+*/
+/**************************************************************************/
+void Pixie::set_number_format(uint8_t width, char pad, uint8_t align){
+	if(align == PIX_ALIGN_LEFT && pad == '0'){ // "42000" isn't 42
+		pad = ' ';
 	}
-	return places;
+	num_width = width;
+	num_pad   = pad;
+	num_align = align;
 }
 
-uint8_t Pixie::get_length(uint32_t input){
-	if(input == 0){
-		return 1;
+// Positions **n** takes, including its padding
+uint8_t Pixie::number_length(const PixieNumber& n){
+	uint8_t len = n.negative + 3;
+	if(n.text == NULL){
+		len = n.negative + count_digits(n.whole) + n.places + (n.places != 0);
 	}
-	uint8_t places = 0;
-	while(abs(int32_t(input)) >= 1){
-		input /= 10;
-		places++;
+	if(len < num_width){
+		len = num_width;
 	}
-	return places;
+	return len;
 }
 
-#if defined(ESP8266) || defined(ESP32)
-	uint8_t Pixie::get_length(long unsigned int input){
-		if(input == 0){
-			return 1;
+/*
+	Renders **n** at column **x**, clipped like draw_text(). The digits are
+	made as characters least significant first, then each glyph is copied
+	straight to its columns from right to left. Returns the positions used.
+*/
+uint8_t Pixie::put_number(int16_t x, const PixieNumber& n){
+	char out[24]; // Least significant first: fraction, point, whole part
+	uint8_t len = 0;
+	if(n.text != NULL){
+		for(int8_t i = 2; i >= 0; i--){
+			out[len++] = n.text[i];
 		}
-		uint8_t places = 0;
-		while(abs(int32_t(input)) >= 1){
-			input /= 10;
-			places++;
+	}
+	else{
+		if(n.places != 0){
+			len = decimal_digits(n.frac, out, n.places);
+			out[len++] = '.';
 		}
-		return places;
+		len += decimal_digits(n.whole, out+len, 1);
 	}
-#endif
+	uint8_t total = number_length(n);
+	uint8_t pad   = total - len - n.negative;
+	int16_t right = x + total*5;
+	char    fill  = n.text != NULL ? ' ' : num_pad; // "00inf" isn't a number
+	
+	if(num_align == PIX_ALIGN_LEFT){
+		for(; pad > 0; pad--){
+			right -= 5;
+			put_columns(right, glyph(fill), 5);
+		}
+	}
+	for(uint8_t i = 0; i < len; i++){
+		right -= 5;
+		put_columns(right, glyph(out[i]), 5);
+	}
+	if(num_pad == '0' && n.text == NULL){
+		for(; pad > 0; pad--){
+			right -= 5;
+			put_columns(right, glyph('0'), 5);
+		}
+	}
+	if(n.negative){
+		right -= 5;
+		put_columns(right, glyph('-'), 5);
+	}
+	for(; pad > 0; pad--){
+		right -= 5;
+		put_columns(right, glyph(fill), 5);
+	}
+	return total;
+}
+
+// write() and print() of every number type
+void Pixie::write_number(const PixieNumber& n, uint8_t pos){
+	uint8_t len = put_number(pos*5, n);
+	set_cursor(pos + len);
+}
+
+// push() of every number type, see push(char*)
+void Pixie::push_number(const PixieNumber& n){
+	uint16_t width = number_length(n)*5;
+	if(width >= frame_cols){ // Only the tail stays visible
+		put_number(frame_cols/5*5 - width, n);
+		return;
+	}
+	frame_head = frame_index(width);
+	put_number(frame_cols - width, n);
+}
+
+// shift() of every number type, see shift(char*)
+void Pixie::shift_number(const PixieNumber& n){
+	uint16_t width = number_length(n)*5;
+	if(width < frame_cols){
+		frame_head = frame_index(frame_cols - width);
+	}
+	put_number(0, n);
+}
 
 void Pixie::scroll(char* input){
 	scroll_message(input,150,true);
@@ -1287,214 +2313,94 @@ void Pixie::smooth_scroll(char* input){
 }
 
 void Pixie::scroll_message(char* input, uint16_t wait_ms, bool instant){
-	uint16_t len = strlen(input);
-	if(!instant){
-		if(pix_type == PRO){
-			for(uint16_t c = 0; c < len; c++){
-				char chr = input[c];
-				if (chr >= 32) {
-					chr -= 32;
-				}			
-				
-				push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-				show();
-				delay(5);
-				push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-				show();
-				delay(5);
-				push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-				show();
-				delay(5);
-				push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-				show();
-				delay(5);
-				push_byte(pgm_read_byte(col+(chr * 5 + 4)));
-				show();
-				delay(5);
-				
-				delay(wait_ms);
-			}
-			for(uint8_t i = 0; i < disp_count; i++){
-				push_byte(0);
-				show();
-				delay(5);
-				push_byte(0);
-				show();
-				delay(5);
-				push_byte(0);
-				show();
-				delay(5);
-				push_byte(0);
-				show();
-				delay(5);
-				push_byte(0);
+	uint16_t len = text_length(input);
+	for(uint16_t c = 0; c < len+disp_count; c++){ // Message, then blanks until it has left the chain
+		const uint8_t* src = glyph(' ');
+		if(c < len){
+			src = next_glyph(input);
+		}
+		
+		for(uint8_t i = 0; i < 5; i++){
+			push_byte(pgm_read_byte(src+i));
+			if(!instant){
 				show();
 				delay(5);
-				
-				delay(wait_ms);
 			}
 		}
-		else{
-			for(uint16_t c = 0; c < len; c++){
-				char chr = input[c];
-				if (chr >= 32) {
-					chr -= 32;
-				}			
-				
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(bright);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-				show();
-				delay(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-				show();
-				delay(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-				show();
-				delay(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-				show();
-				delay(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 4)));
-				show();
-				delay(0);
-				
-				delay(wait_ms);
-			}
-			for(uint8_t i = 0; i < disp_count; i++){
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(bright);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				push_byte(0);
-				show();
-				delay(0);
-				
-				delay(wait_ms);
-			}
+		if(instant){
+			show();
 		}
+		delay(wait_ms);
 	}
-	else{
-		if(pix_type == PRO){
-			for(uint16_t c = 0; c < len; c++){
-				char chr = input[c];
-				if (chr >= 32) {
-					chr -= 32;
-				}
-				
-				push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 4)));
-				show();			
-				delay(wait_ms);
-			}
-			for(uint8_t i = 0; i < disp_count; i++){
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				show();			
-				delay(wait_ms);
-			}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Scrolls a message across the chain in a proportional font, one
+	column at a time, until it has left the chain. Narrow glyphs pass in
+	fewer steps than with the 5 column font.
+	
+    @param	input	Message to scroll
+	@param	font	Font to scroll in, such as PIX_FONT_PROP
+	@param	col_ms	Delay after each column, on top of show()
+*/
+/**************************************************************************/
+void Pixie::scroll_message(char* input, const PixieFont& font, uint16_t col_ms){
+	uint16_t cols = text_width(input, font) + disp_count*5; // Then blanks until it has left the chain
+	uint8_t width = 0;
+	uint8_t step  = 0; // Columns of the current glyph and its spacing
+	uint8_t c     = 0;
+	const uint8_t* src = NULL;
+	for(uint16_t i = 0; i < cols; i++){
+		while(c >= step && *input != 0){
+			char chr = *input;
+			src  = next_glyph(input, font, &width);
+			step = width + glyph_spacing(chr, *input, font);
+			c    = 0;
 		}
-		else{
-			for(uint16_t c = 0; c < len; c++){
-				char chr = input[c];
-				if (chr >= 32) {
-					chr -= 32;
-				}
-				
-				push_byte(0);
-				push_byte(bright);
-				push_byte(0);
-				push_byte(pgm_read_byte(col+(chr * 5 + 0)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 1)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 2)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 3)));
-				push_byte(pgm_read_byte(col+(chr * 5 + 4)));
-				show();			
-				delay(wait_ms);
-			}
-			for(uint8_t i = 0; i < disp_count; i++){
-				push_byte(0);
-				push_byte(bright);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				push_byte(0);
-				show();			
-				delay(wait_ms);
-			}
+		uint8_t col = 0;
+		if(c < width){
+			col = pgm_read_byte(src+c);
 		}
+		if(c < step){ // Stays at step once the message is out: blank tail
+			c++;
+		}
+		push_byte(col);
+		show();
+		delay(col_ms);
 	}
 }
 
 void Pixie::dump_buffer(){
+	encode(0, pixie_count);
+	uint16_t total_bytes = disp_count * 8;
 	if(pix_type == PRO){
-		for (uint16_t b = 0; b < pixie_count * 13; b++) {
-			for (uint8_t i = 0; i < 8; i++) {
-				if(bitRead(display_buffer[b], 7 - i)){
-					Serial.print(1);
-				}
-				else{
-					Serial.print(0);
-				}
+		total_bytes = pixie_count * 13;
+	}
+	for (uint16_t b = 0; b < total_bytes; b++) {
+		for (uint8_t i = 0; i < 8; i++) {
+			if(bitRead(display_buffer[b], 7 - i)){
+				Serial.print(1);
 			}
-		}
-		Serial.println("\n");
-	}
-	else{		
-		for (uint16_t b = 0; b < disp_count * 8; b++) {
-			for (uint8_t i = 0; i < 8; i++) {
-				if(bitRead(display_buffer[b], 7 - i)){
-					Serial.print(1);
-				}
-				else{
-					Serial.print(0);
-				}
+			else{
+				Serial.print(0);
 			}
 		}
-		Serial.println("\n");
 	}
+	Serial.println("\n");
 }
 
 void Pixie::command(uint8_t com, uint8_t data){	
+	if(pix_type != PRO){
+		return; // Only Pixie Pro firmware has a command header
+	}
 	for(uint8_t i = 0; i < pixie_count; i++){	
 		display_buffer[i*13+0] = com;
 		display_buffer[i*13+1] = data;
-		display_buffer[i*13+2] = bright;
 	}
 	
 	show(false);
+	mark_modules(0, pixie_count-1); // Their headers still hold the command
 }
 
 void Pixie::reset() {
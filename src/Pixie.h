@@ -14,28 +14,146 @@
 // - There are two built-in fonts to choose from.
 //   Uncomment a single option below to choose.
 //   (font_alt has fancy numerals)
+//   Both are constexpr, so Pixie_Text.h can render them at compile time.
 
 	#include "font.h"
 //	#include "font_alt.h"
 // ------------------------
 
+/**************************************************************************/
+/*! 
+    @brief	A proportional font: glyphs of any width, packed in PROGMEM.
+	Used by the PixieFont overloads of draw_text(), push(), shift() and
+	scroll_message(). PIX_FONT_PROP (font_prop.h) is built from font.h.
+*/
+/**************************************************************************/
+struct PixieFont{
+	const uint8_t*  columns;  // Glyph columns back to back, bit 0 at the top
+	const uint16_t* offsets;  // Start of each glyph in columns, count+1 entries
+	const int8_t*   kerning;  // {left, right, adjust} sorted by pair and 0 terminated, or NULL
+	uint8_t first;            // Character of the first glyph
+	uint8_t count;            // Number of glyphs
+	uint8_t spacing;          // Blank columns after each glyph
+};
+
+#include "font_prop.h"
+
+/**************************************************************************/
+/*! 
+    @brief	Extra 5 column glyphs for UTF-8 text, found by code point.
+	Characters beyond ASCII are looked up here once set_glyphs() is called.
+	PIX_GLYPHS_EXT (font_ext.h) covers Latin-1, Greek, arrows and box drawing.
+*/
+/**************************************************************************/
+struct PixieGlyphs{
+	const uint16_t* codepoints; // Sorted code points, in PROGMEM
+	const uint8_t*  columns;    // 5 columns per glyph, bit 0 at the top
+	uint16_t count;             // Number of glyphs
+};
+
+#define PIX_PACK7 0 // PixieAssets formats: 7 bits per column
+#define PIX_RLE   1 // Literal or repeated columns, with an index of bit offsets
+
+/**************************************************************************/
+/*! 
+    @brief	A set of equal-width bitmaps (icons, glyphs) bit-packed in
+	PROGMEM and looked up by ID, see extras/pack_assets.py.
+	Pixie_Icon_Pack_P.h has the whole icon pack in this format.
+*/
+/**************************************************************************/
+struct PixieAssets{
+	const uint8_t*  data;     // Bit stream, least significant bit first
+	const uint16_t* index;    // Bit offset of each asset (PIX_RLE), or NULL
+	uint16_t count;           // Number of assets
+	uint8_t  width;           // Columns per asset
+	uint8_t  format;          // PIX_PACK7 or PIX_RLE
+};
+
+/**************************************************************************/
+/*! 
+    @brief	An animation in PROGMEM for PixiePlayer: the first frame whole,
+	then one delta per frame of the columns that change, XORed. See
+	extras/pack_animation.py, which makes them from frame arrays.
+*/
+/**************************************************************************/
+struct PixieAnimation{
+	const uint8_t*  data;      // Keyframe, then per frame: changed-column bitmap and XOR bytes
+	const uint16_t* durations; // ms each frame stays up, or NULL for frame_ms
+	uint16_t frames;           // Number of frames
+	uint16_t frame_ms;         // ms per frame without durations
+	uint8_t  width;            // Columns per frame
+};
+
+/**************************************************************************/
+/*! 
+    @brief	A number split into what write(), print(), push() and shift()
+	render: whole and fractional digits, or a word like "nan" for floats
+	that can't be shown.
+*/
+/**************************************************************************/
+struct PixieNumber{
+	uint32_t whole;           // Integer part, without the sign
+	uint32_t frac;            // Fractional part as an integer of **places** digits
+	uint8_t  places;          // Digits after the decimal point, 0 for none
+	bool     negative;
+	const char* text;         // "nan", "inf" or "ovf" instead of digits, or NULL
+};
+
+/**************************************************************************/
+/*! 
+    @brief	**W** columns of text rendered at compile time by PIXIE_TEXT()
+	(Pixie_Text.h), meant to be declared constexpr in PROGMEM. Drawn with
+	write() or draw_text() as one block copy.
+*/
+/**************************************************************************/
+template<uint16_t W>
+struct PixieText{
+	uint8_t columns[W];       // Bit 0 at the top
+};
+
 #define LEGACY 0  // Original Pixies with 128 bit buffer
 #define PRO    1  // Pixie Pro with 104-bit buffer
+#define PRO_CRC 2 // Pixie Pro with 104-bit buffer, CRC-8 checked (Firmware 1.3.0+)
 
 #define LEGACY_SPEED 12  // ~39kHz bitrate
 #define FULL_SPEED   7   // ~67kHz bitrate (Firmware 1.1.0+)
+#define USI_SPEED    2   // ~250kHz bitrate (Firmware 1.4.0 USI, PRO_CRC only)
 
 #define PIX_WRITE       0
 #define PIX_LED_FLIP    1
 #define PIX_ROW_CURRENT 2
 #define PIX_RESET 	3
 
+#define PIX_CLAMP 0 // Viewport stops at the canvas edges
+#define PIX_WRAP  1 // Viewport wraps around the canvas
+
+#define PIX_NORMAL     0 // set_orientation() modes
+#define PIX_MIRROR_X   1 // Columns right to left
+#define PIX_MIRROR_Y   2 // Rows bottom to top
+#define PIX_ROTATE_180 3 // Both: the chain mounted upside down
+
+#define PIX_BLINK     1 // set_attribute() flags: blank in the off phase of the blink
+#define PIX_INVERT    2 // Lit and unlit pixels swapped
+#define PIX_UNDERLINE 4 // Bottom row lit
+#define PIX_DIM       8 // Every other pixel, in a checkerboard
+
+#define PIX_ALIGN_RIGHT 0 // set_number_format() alignments
+#define PIX_ALIGN_LEFT  1
+
+#define PIX_OP_COPY   0 // blit() raster operations
+#define PIX_OP_OR     1
+#define PIX_OP_AND    2
+#define PIX_OP_XOR    3
+#define PIX_OP_ANDNOT 4
+
 #define mA_5   8
 #define mA_10  9
 #define mA_35 14
 #define mA_40  0
 #define mA_45  1
 
+template<uint8_t N, uint8_t TYPE, uint16_t CANVAS> class PixieFixed;
+
 /**************************************************************************/
 /*! 
     @brief	Pixie class, containing all of the coolest functions!
@@ -46,8 +164,13 @@ class Pixie{
     Pixie(uint8_t d_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type = LEGACY);
         void begin(uint8_t speed = LEGACY_SPEED); // Defaults to LEGACY_SPEED
 	void show(bool fill_com = true);
+	bool show_changes();
+	void mark_dirty(int16_t x, uint16_t w);
 	void brightness(uint8_t b);
 	void write_brightness(uint8_t bright, uint8_t pos);
+	void set_brightness(uint8_t b, uint8_t module);
+	void set_brightness(const uint8_t* levels);
+	uint8_t get_brightness(uint8_t module);
 	void clear();
 	
 	void command(uint8_t com, uint8_t data = 0);
@@ -66,7 +189,12 @@ class Pixie{
 	void write(double input, uint8_t places = 2, uint8_t pos = 0);
 	void write(uint8_t* icon, uint8_t pos = 0);
 	void write(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5, uint8_t pos = 0);	
+	void write(const PixieAssets& set, uint16_t id, uint8_t pos = 0);
+	template<uint16_t W> void write(const PixieText<W>& text, uint8_t pos = 0){
+		write_P(text.columns, W, pos);
+	}
 	void write_byte(uint8_t col, uint16_t pos);
+	uint8_t read_byte(uint16_t pos);
 	
 	void print_char(char input);
 	void print(char     input);
@@ -82,13 +210,16 @@ class Pixie{
 	void print(double input, uint8_t places = 2);
 	void print(uint8_t* icon);
 	void print(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5);
+	void print(const PixieAssets& set, uint16_t id);
 	
 	void set_cursor(uint8_t pos);
+	void set_number_format(uint8_t width, char pad = ' ', uint8_t align = PIX_ALIGN_RIGHT);
 
 	void push_char(char chr);	
 	void push_byte(uint8_t col);
 	void push(char     input);
 	void push(char*    input);
+	void push(char*    input, const PixieFont& font);
 	void push(int16_t  input);
 	void push(uint16_t input);
 	void push(int32_t  input);
@@ -100,11 +231,13 @@ class Pixie{
 	void push(double input, uint8_t places = 2);
 	void push(uint8_t* icon);
 	void push(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5);
+	void push(const PixieAssets& set, uint16_t id);
 	
 	void shift_char(char chr);	
 	void shift_byte(uint8_t col);
 	void shift(char     input);
 	void shift(char*    input);
+	void shift(char*    input, const PixieFont& font);
 	void shift(int16_t  input);
 	void shift(uint16_t input);
 	void shift(int32_t  input);
@@ -116,8 +249,26 @@ class Pixie{
 	void shift(double input, uint8_t places = 2);
 	void shift(uint8_t* icon);
 	void shift(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4, uint8_t byte5);
+	void shift(const PixieAssets& set, uint16_t id);
 	
-	void draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+	void draw_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t state = 1);
+	void draw_hline(int16_t x, int16_t y, int16_t w, uint8_t state = 1);
+	void draw_vline(int16_t x, int16_t y, int16_t h, uint8_t state = 1);
+	void draw_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t state = 1);
+	void fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t state = 1);
+	void draw_circle(int16_t x0, int16_t y0, int16_t r, uint8_t state = 1);
+	void fill_circle(int16_t x0, int16_t y0, int16_t r, uint8_t state = 1);
+	uint16_t draw_text(char* input, int16_t x);
+	uint16_t draw_text(char* input, int16_t x, const PixieFont& font);
+	template<uint16_t W> uint16_t draw_text(const PixieText<W>& text, int16_t x){
+		return draw_P(text.columns, W, x);
+	}
+	uint16_t draw_P(const uint8_t* columns, uint16_t width, int16_t x);
+	uint16_t text_width(char* input, const PixieFont& font);
+	uint16_t text_length(char* input);
+	void blit(const uint8_t* bitmap, uint16_t width, int16_t x, int8_t y = 0, uint8_t op = PIX_OP_COPY);
+	void blit(const PixieAssets& set, uint16_t id, int16_t x, int8_t y = 0, uint8_t op = PIX_OP_COPY);
+	uint8_t unpack(const PixieAssets& set, uint16_t id, uint8_t* out);
 	
 	uint8_t get_length(uint32_t input);
 	#if defined(ESP8266) || defined(ESP32)
@@ -125,34 +276,99 @@ class Pixie{
 	#endif
 	uint8_t get_length(int32_t input);
 	uint8_t get_length(float input, uint8_t places);
+	static uint8_t decimal_digits(uint32_t value, char* out, uint8_t min = 1);
 		
 	void scroll_message(char* input, uint16_t wait_ms = 100, bool instant = false);
+	void scroll_message(char* input, const PixieFont& font, uint16_t col_ms = 20);
 	void scroll(char* input);
 	void smooth_scroll(char* input);
 		
 	void set_pix(uint16_t x, uint16_t y, uint8_t state);
 	
+	const uint8_t* glyph(char chr);
+	const uint8_t* glyph(char chr, const PixieFont& font, uint8_t* width);
+	uint8_t glyph_spacing(char chr, char next, const PixieFont& font);
+	const uint8_t* next_glyph(char*& input);
+	const uint8_t* next_glyph(char*& input, const PixieFont& font, uint8_t* width);
+	uint16_t next_codepoint(char*& input);
+	void set_glyphs(const PixieGlyphs& glyphs);
+	uint8_t display_count();
+	uint8_t module_count();
+	
+	void canvas(uint16_t width);
+	bool set_view(int32_t x);
+	bool move_view(int16_t dx);
+	uint16_t get_view();
+	uint16_t canvas_width();
+	void set_view_mode(uint8_t mode);
+	void set_orientation(uint8_t mode);
+	uint8_t get_orientation();
+	void flipped(bool flip = true);
+	void set_attribute(uint8_t pos, uint8_t attr);
+	uint8_t get_attribute(uint8_t pos);
+	void clear_attributes();
+	void set_blink_phase(bool on);
+	bool update_blink(uint16_t ms = 500);
+	
 	void dump_buffer();
 	
 	void reset();
 	
   private:
-	void calc_parity();
-	void fill_commands();
+	template<uint8_t N, uint8_t TYPE, uint16_t CANVAS> friend class PixieFixed;
+	Pixie(uint8_t p_count, uint8_t c_pin, uint8_t d_pin, uint8_t p_type, uint8_t* frame_buf, uint16_t frame_len, uint8_t* display_buf, uint8_t* attr_buf);
+	void send(uint16_t total_bytes);
+	uint16_t prepare(bool fill_com, uint8_t first, uint8_t end);
+	void calc_parity(uint8_t first, uint8_t end);
+	void calc_crc(uint8_t first, uint8_t end);
+	void fill_commands(uint8_t first, uint8_t end);
+	void encode(uint8_t first, uint8_t end);
+	void apply_attributes(uint8_t first, uint8_t end);
+	void mark_position(uint8_t pos);
+	void mark_modules(uint8_t first, uint8_t last);
+	uint16_t frame_index(uint16_t x);
+	void copy_columns_P(uint16_t x, const uint8_t* src, uint16_t n);
+	uint16_t put_columns(int16_t x, const uint8_t* src, uint16_t n);
+	void write_P(const uint8_t* columns, uint16_t width, uint8_t pos);
+	const uint8_t* ext_glyph(uint16_t code);
+	uint8_t number_length(const PixieNumber& n);
+	uint8_t put_number(int16_t x, const PixieNumber& n);
+	void write_number(const PixieNumber& n, uint8_t pos);
+	void push_number(const PixieNumber& n);
+	void shift_number(const PixieNumber& n);
+	uint8_t row_mask(int16_t y, int16_t h);
+	void span(int16_t x, int16_t w, uint8_t mask, uint8_t state);
+	void mask_column(int16_t x, uint8_t mask, uint8_t state);
+	void row_run(int16_t xa, int16_t xb, int16_t y, uint8_t state);
 	uint8_t clk_us = LEGACY_SPEED;
 
 	uint8_t pix_type = LEGACY;
+	bool crc_packets = false;
 	uint8_t pixie_count  = 0;
 	uint8_t disp_count   = 0;
 	
 	uint8_t bright = 255;
 	uint8_t CLK_pin;
 	uint8_t DAT_pin;
-	uint8_t *display_buffer;
+	uint8_t *display_buffer; // Wire layout, rebuilt from frame by encode()
+	uint8_t *frame;          // Logical columns, left to right, bit 0 at the top
+	uint16_t frame_cols = 0;
+	uint16_t frame_size = 0; // Size of a static frame (PixieFixed), 0 if it is on the heap
+	uint16_t frame_head = 0; // Storage index of the leftmost column
+	uint16_t view_x = 0;     // Canvas column shown at the left edge of the chain
+	uint8_t view_mode = PIX_CLAMP;
 	uint8_t cursor_pos = 0;
+	uint8_t dirty_first = 255; // Modules whose packets are stale since show(), see mark_dirty()
+	uint8_t dirty_last  = 0;
 	bool push_flip = false;
-	
-	bool display_flipped = false;
+	const PixieGlyphs* ext_glyphs = NULL; // Glyphs beyond ASCII, see set_glyphs()
+	uint8_t num_width = 0;   // Minimum positions for a number, see set_number_format()
+	char    num_pad   = ' ';
+	uint8_t num_align = PIX_ALIGN_RIGHT;
+	uint8_t orientation = PIX_NORMAL; // See set_orientation(), applied by encode()
+	uint8_t *attributes;     // One per display position, see set_attribute()
+	uint8_t attr_count = 0;  // Positions with attributes, encode() skips them all at 0
+	bool blink_on = true;    // Blink phase, see set_blink_phase()
 };
 
 #endif
@@ -0,0 +1,160 @@
+/*!
+ * @file Pixie_Fader.cpp
+ *
+ * Non-blocking brightness fades for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Fader.h"
+
+/**************************************************************************/
+/*!
+	Attaches a fader to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieFader fader(pix);
+	</pre>
+	then fader.fade_to(127, 500); and in loop(): fader.update(); pix.show();
+*/
+/**************************************************************************/
+PixieFader::PixieFader(Pixie& display){
+	pix = &display;
+	count = pix->module_count();
+	fades = new Fade[count];
+	memset(fades, 0, count*sizeof(Fade));
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fades every module from its current brightness to **level**
+	
+    @param	level	Target brightness (0-127)
+	@param	ms		Length of the fade in milliseconds
+	@param	ease	PIX_EASE_LINEAR, PIX_EASE_IN, PIX_EASE_OUT or PIX_EASE_IN_OUT
+*/
+/**************************************************************************/
+void PixieFader::fade_to(uint8_t level, uint16_t ms, uint8_t ease){
+	for(uint8_t i = 0; i < count; i++){
+		fade_to(level, ms, ease, i);
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fades one module from its current brightness to **level**. The
+	others carry on with their own fades.
+	
+    @param	level	Target brightness (0-127)
+	@param	ms		Length of the fade in milliseconds
+	@param	ease	PIX_EASE_LINEAR, PIX_EASE_IN, PIX_EASE_OUT or PIX_EASE_IN_OUT
+	@param	module	Module to fade, 0 is the one showing display positions 0 and 1
+*/
+/**************************************************************************/
+void PixieFader::fade_to(uint8_t level, uint16_t ms, uint8_t ease, uint8_t module){
+	if(module >= count){
+		return;
+	}
+	Fade& f = fades[module];
+	f.start  = millis();
+	f.length = ms;
+	f.from   = pix->get_brightness(module);
+	f.to     = level & 0x7F;
+	f.ease   = ease;
+	if(ms == 0){ // Nothing to ease, it's set on the next update()
+		f.length = 1;
+		f.start -= 1;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Fades each module to its own level, **levels** has one entry per
+	module (see Pixie::module_count())
+*/
+/**************************************************************************/
+void PixieFader::fade_to(const uint8_t* levels, uint16_t ms, uint8_t ease){
+	for(uint8_t i = 0; i < count; i++){
+		fade_to(levels[i], ms, ease, i);
+	}
+}
+
+// **p** (0-256) of the way through a fade, eased, also 0-256
+uint16_t PixieFader::eased(uint16_t p, uint8_t ease){
+	if(ease == PIX_EASE_IN){
+		return ((uint32_t)p * p) >> 8;
+	}
+	if(ease == PIX_EASE_OUT){
+		uint16_t q = 256 - p;
+		return 256 - (((uint32_t)q * q) >> 8);
+	}
+	if(ease == PIX_EASE_IN_OUT){
+		return ((uint32_t)p * p * (768 - 2*p)) >> 16;
+	}
+	return p;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves every running fade on to where it should be by now and
+	puts the levels in the display buffer. Nothing is sent, call show() as
+	usual afterwards. Call this as often as possible from loop().
+	
+    @return	True if any module's brightness changed
+*/
+/**************************************************************************/
+bool PixieFader::update(){
+	uint32_t now = millis();
+	bool changed = false;
+	uint32_t last_start  = 0;
+	uint16_t last_length = 0;
+	uint16_t p = 0;
+	for(uint8_t i = 0; i < count; i++){
+		Fade& f = fades[i];
+		if(f.length == 0){
+			continue;
+		}
+		uint32_t elapsed = now - f.start;
+		uint8_t level = f.to;
+		if(elapsed < f.length){
+			if(f.start != last_start || f.length != last_length){ // Fades started together share one division
+				p = (elapsed << 8) / f.length;
+				last_start  = f.start;
+				last_length = f.length;
+			}
+			level = f.from + (((int16_t)(f.to - f.from) * (int16_t)eased(p, f.ease)) >> 8);
+		}
+		else{
+			f.length = 0;
+		}
+		if(level != pix->get_brightness(i)){
+			pix->set_brightness(level, i);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns true once every fade has reached its level, or if nothing was started
+*/
+/**************************************************************************/
+bool PixieFader::done(){
+	for(uint8_t i = 0; i < count; i++){
+		if(fades[i].length != 0){
+			return false;
+		}
+	}
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Stops every fade, leaving the brightness where it is
+*/
+/**************************************************************************/
+void PixieFader::stop(){
+	for(uint8_t i = 0; i < count; i++){
+		fades[i].length = 0;
+	}
+}
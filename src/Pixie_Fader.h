@@ -0,0 +1,51 @@
+/*!
+ * @file Pixie_Fader.h
+ *
+ * Non-blocking brightness fades for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_fader_h
+#define pixie_fader_h
+#include "Pixie.h"
+
+#define PIX_EASE_LINEAR 0 // Constant rate
+#define PIX_EASE_IN     1 // Starts slow (quadratic), also looks more even to the eye when fading up
+#define PIX_EASE_OUT    2 // Ends slow
+#define PIX_EASE_IN_OUT 3 // Starts and ends slow (smoothstep)
+
+/**************************************************************************/
+/*! 
+    @brief	Fades the brightness of a Pixie chain from the main loop, each
+	module to its own target if needed. update() only changes the levels
+	in the display buffer, so they go out with the next regular show()
+	instead of in extra frames.
+*/
+/**************************************************************************/
+class PixieFader{
+  public:
+	PixieFader(Pixie& display);
+	void fade_to(uint8_t level, uint16_t ms, uint8_t ease = PIX_EASE_IN_OUT);
+	void fade_to(uint8_t level, uint16_t ms, uint8_t ease, uint8_t module);
+	void fade_to(const uint8_t* levels, uint16_t ms, uint8_t ease = PIX_EASE_IN_OUT);
+	bool update();
+	bool done();
+	void stop();
+	
+  private:
+	struct Fade{
+		uint32_t start;   // millis() when it began
+		uint16_t length;  // ms, 0 once it is finished
+		uint8_t  from;
+		uint8_t  to;
+		uint8_t  ease;
+	};
+	
+	static uint16_t eased(uint16_t p, uint8_t ease);
+	
+	Pixie* pix;
+	Fade* fades;          // One per module
+	uint8_t count;
+};
+
+#endif
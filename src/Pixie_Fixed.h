@@ -0,0 +1,96 @@
+/*!
+ * @file Pixie_Fixed.h
+ *
+ * Pixie chain with its size and type fixed at compile time.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_fixed_h
+#define pixie_fixed_h
+#include "Pixie.h"
+
+/**************************************************************************/
+/*! 
+    @brief	A Pixie chain of **N** modules of type **TYPE** (LEGACY, PRO or
+	PRO_CRC), with its frame and wire buffers inside the object instead of
+	on the heap. Declared globally, they are static RAM the compiler can
+	count. show() is built for this one layout: strides and counts are
+	constants and the other type's branches are gone.
+	
+	Everything else is the Pixie API. Calls through a Pixie& or Pixie*
+	(PixieScroller, for one) use the regular show(), which sends the
+	same packets.
+	
+	Example usage before setup():
+	<pre>
+	PixieFixed<3, PRO_CRC> pix(CLK_PIN, DATA_PIN);
+	</pre>
+*/
+/**************************************************************************/
+template<uint8_t N, uint8_t TYPE = LEGACY, uint16_t CANVAS = N*10>
+class PixieFixed : public Pixie{
+	static_assert(N >= 1 && N <= 127, "1 to 127 modules");
+	static_assert(CANVAS >= N*10, "the canvas must be at least as wide as the chain");
+	
+  public:
+	static constexpr bool     IS_PRO  = (TYPE != LEGACY);
+	static constexpr uint8_t  STRIDE  = IS_PRO ? 13 : 8;  // Bytes per packet
+	static constexpr uint8_t  COLS    = IS_PRO ? 10 : 5;  // Columns per packet
+	static constexpr uint8_t  PACKETS = IS_PRO ? N : N*2;
+	static constexpr uint16_t BYTES   = PACKETS * STRIDE;
+	
+	PixieFixed(uint8_t c_pin, uint8_t d_pin)
+		: Pixie(N, c_pin, d_pin, TYPE, frame_storage, CANVAS, buffer_storage, attr_storage){
+	}
+	
+	/**************************************************************************/
+	/*!
+	    @brief	Latches the current display buffer and writes it to the chain,
+		like Pixie::show()
+	*/
+	/**************************************************************************/
+	void show(bool fill_com = true){
+		yield();
+		encode_fixed();
+		if(IS_PRO){
+			if(fill_com){
+				fill_commands(0, N);
+			}
+			if(TYPE == PRO_CRC){
+				calc_crc(0, N);
+			}
+			else{
+				calc_parity(0, N);
+			}
+		}
+		send(BYTES);
+		dirty_first = 255;
+		dirty_last  = 0;
+	}
+	
+  private:
+	// Pixie::encode() with the layout known: the column loop has a constant count
+	void encode_fixed(){
+		if(orientation != PIX_NORMAL || attr_count > 0){
+			encode(0, N);
+			return;
+		}
+		uint16_t i = frame_index(view_x);
+		uint8_t* dst = buffer_storage + 3;
+		for(uint8_t p = 0; p < PACKETS; p++){
+			for(uint8_t c = 0; c < COLS; c++){
+				dst[c] = frame_storage[i] & 0x7F;
+				if(++i == frame_cols){
+					i = 0;
+				}
+			}
+			dst += STRIDE;
+		}
+	}
+	
+	uint8_t frame_storage[CANVAS];
+	uint8_t buffer_storage[BYTES];
+	uint8_t attr_storage[N*2];
+};
+
+#endif
@@ -0,0 +1,184 @@
+/*!
+ * @file Pixie_Gray.cpp
+ *
+ * Grayscale on Pixie displays by temporal dithering of bit planes.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Gray.h"
+
+// Bit k of **level** moved to bit 0 of byte k. Multiplying by 1 + 2^7 + 2^14
+// + 2^21 shifts bit k by 7k, to 8k, and no two bits land on each other.
+static uint32_t spread_level(uint8_t level){
+	return ((uint32_t)level * 0x00204081) & 0x01010101;
+}
+
+/**************************************************************************/
+/*!
+	Attaches a grayscale frame to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN, PRO_CRC);
+	PixieGray gray(pix, 3); // 8 levels
+	</pre>
+	then draw with gray.set_pix() and call gray.update() as often as
+	possible from loop(), instead of pix.show().
+	
+    @param	display	Chain to show the frame on
+	@param	bits	Bits per pixel, 2 to 4 (4, 8 or 16 levels)
+*/
+/**************************************************************************/
+PixieGray::PixieGray(Pixie& display, uint8_t bits){
+	pix = &display;
+	if(bits < 2){
+		bits = 2;
+	}
+	if(bits > 4){
+		bits = 4;
+	}
+	plane_bits = bits;
+	width = pix->display_count()*5;
+	cols = new uint32_t[width];
+	clear();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets every pixel to level 0
+*/
+/**************************************************************************/
+void PixieGray::clear(){
+	memset(cols, 0, width*sizeof(uint32_t));
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the pixels of column **x** that are set in **rows** (bit 0
+	at the top) to **level**, and leaves the others. All planes change in
+	one masked write.
+*/
+/**************************************************************************/
+void PixieGray::put_column(int16_t x, uint8_t rows, uint8_t level){
+	if(x < 0 || x >= width){
+		return;
+	}
+	if(level >= levels()){
+		level = levels() - 1;
+	}
+	uint32_t mask = (rows & 0x7F) * (uint32_t)0x01010101;     // **rows** in every plane
+	uint32_t bits = spread_level(level) * 0xFF;               // Each plane all 1s or all 0s
+	cols[x] = (cols[x] & ~mask) | (bits & mask);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets the pixel at (**x**,**y**) to **level** (0 to levels()-1,
+	higher levels are the brightest)
+*/
+/**************************************************************************/
+void PixieGray::set_pix(int16_t x, int16_t y, uint8_t level){
+	if(y < 0 || y >= 7){
+		return;
+	}
+	put_column(x, 1 << y, level);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the level of the pixel at (**x**,**y**), 0 if it is off the chain
+*/
+/**************************************************************************/
+uint8_t PixieGray::get_pix(int16_t x, int16_t y){
+	if(x < 0 || x >= width || y < 0 || y >= 7){
+		return 0;
+	}
+	uint32_t bits = (cols[x] >> y) & 0x01010101;
+	return (bits * 0x01020408) >> 24; // Bit 8k to bit 24+k, as in spread_level()
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws the lit pixels of a string in the 5 column font at **level**.
+	Unlit pixels keep their level, so text can go over a gradient.
+	
+    @return	Number of columns the string takes
+*/
+/**************************************************************************/
+uint16_t PixieGray::draw_text(char* input, int16_t x, uint8_t level){
+	int16_t start = x;
+	while(*input != 0){
+		const uint8_t* src = pix->next_glyph(input);
+		for(uint8_t c = 0; c < 5; c++){
+			put_column(x + c, pgm_read_byte(src + c), level);
+		}
+		x += 5;
+	}
+	return x - start;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets how long plane 0 stays up, in microseconds. By default
+	it is the time of one show(), measured on the first update(): the
+	shortest it can be. Plane k stays up 2^k times as long.
+*/
+/**************************************************************************/
+void PixieGray::set_unit(uint32_t us){
+	unit_us = us;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of gray levels, 2^bits
+*/
+/**************************************************************************/
+uint8_t PixieGray::levels(){
+	return 1 << plane_bits;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the time to show every plane once (0 until the first update())
+*/
+/**************************************************************************/
+uint32_t PixieGray::cycle_us(){
+	return unit_us * ((1 << plane_bits) - 1);
+}
+
+// Puts plane **plane** in the chain's buffer and sends it
+void PixieGray::send_plane(){
+	uint8_t shift = plane * 8;
+	for(uint16_t x = 0; x < width; x++){
+		pix->write_byte((cols[x] >> shift) & 0x7F, x);
+	}
+	sent_at = micros();
+	pix->show();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sends the next bit plane once the current one has been up for its
+	share of the cycle. Call this as often as possible from loop(): any time
+	past a plane's due time makes that plane stay up longer than it should.
+	
+    @return	True if a plane was sent
+*/
+/**************************************************************************/
+bool PixieGray::update(){
+	if(!running){
+		running = true;
+		plane = 0;
+		send_plane();
+		if(unit_us == 0){
+			unit_us = micros() - sent_at; // show() can't go faster than this
+		}
+		return true;
+	}
+	if(micros() - sent_at < (unit_us << plane)){ // Frames start at their latch interval apart
+		return false;
+	}
+	if(++plane == plane_bits){
+		plane = 0;
+	}
+	send_plane();
+	return true;
+}
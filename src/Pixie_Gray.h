@@ -0,0 +1,51 @@
+/*!
+ * @file Pixie_Gray.h
+ *
+ * Grayscale on Pixie displays by temporal dithering of bit planes.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_gray_h
+#define pixie_gray_h
+#include "Pixie.h"
+
+/**************************************************************************/
+/*! 
+    @brief	A grayscale frame (2 to 4 bits per pixel) shown on a Pixie chain
+	as a loop of binary frames, one per bit plane. Plane k stays up 2^k
+	times as long as plane 0, so each pixel is lit for a share of the time
+	that matches its level.
+	
+	Each column is one 32-bit word with byte k holding plane k (bit 0 at
+	the top), so drawing changes all planes with one masked write and
+	sending a plane is a shift. Needs a fast, steady frame rate: see
+	extras/emulator/README.md for the levels each chain length can hold.
+*/
+/**************************************************************************/
+class PixieGray{
+  public:
+	PixieGray(Pixie& display, uint8_t bits = 2);
+	void clear();
+	void set_pix(int16_t x, int16_t y, uint8_t level);
+	uint8_t get_pix(int16_t x, int16_t y);
+	void put_column(int16_t x, uint8_t rows, uint8_t level);
+	uint16_t draw_text(char* input, int16_t x, uint8_t level);
+	void set_unit(uint32_t us);
+	bool update();
+	uint8_t levels();
+	uint32_t cycle_us();
+	
+  private:
+	void send_plane();
+	
+	Pixie* pix;
+	uint32_t* cols;          // One word per column, byte k is plane k
+	uint16_t width;
+	uint8_t  plane_bits;
+	uint8_t  plane    = 0;   // Plane on the displays
+	uint32_t unit_us  = 0;   // Time plane 0 stays up, 0 until measured
+	uint32_t sent_at  = 0;   // micros() when the current plane's frame started
+	bool     running  = false;
+};
+
+#endif
@@ -1,4 +1,5 @@
 /* PIXIE BITMAP ICONS */ 
+// These arrays are in RAM. Pixie_Icon_Pack_P.h has the same icons in flash, see PixieAssets.
 
 // ARROWS
 uint8_t PIX_ARROW_UP[]         = {0x04,0x02,0x7F,0x02,0x04};
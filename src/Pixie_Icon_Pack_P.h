@@ -0,0 +1,293 @@
+// Generated by extras/pack_assets.py from Pixie_Icon_Pack.h, do not edit.
+// 222 icons, 5 columns each, 7 bits per column: 972 bytes of flash instead of 1110.
+
+enum{
+	PIX_ICON_ARROW_UP,                 // 0
+	PIX_ICON_ARROW_UP_LEFT,            // 1
+	PIX_ICON_ARROW_UP_RIGHT,           // 2
+	PIX_ICON_ARROW_DOWN,               // 3
+	PIX_ICON_ARROW_DOWN_LEFT,          // 4
+	PIX_ICON_ARROW_DOWN_RIGHT,         // 5
+	PIX_ICON_ARROW_LEFT,               // 6
+	PIX_ICON_ARROW_RIGHT,              // 7
+	PIX_ICON_UNDO,                     // 8
+	PIX_ICON_REDO,                     // 9
+	PIX_ICON_REFRESH,                  // 10
+	PIX_ICON_TRIANGLE_UP,              // 11
+	PIX_ICON_TRIANGLE_DOWN,            // 12
+	PIX_ICON_TRIANGLE_LEFT,            // 13
+	PIX_ICON_TRIANGLE_RIGHT,           // 14
+	PIX_ICON_HEART,                    // 15
+	PIX_ICON_SMILE,                    // 16
+	PIX_ICON_FROWN,                    // 17
+	PIX_ICON_HAPPY,                    // 18
+	PIX_ICON_SAD,                      // 19
+	PIX_ICON_ANGRY,                    // 20
+	PIX_ICON_NO,                       // 21
+	PIX_ICON_DO_NOT_ENTER,             // 22
+	PIX_ICON_MAIL,                     // 23
+	PIX_ICON_PHONE_CALL,               // 24
+	PIX_ICON_WIRELESS,                 // 25
+	PIX_ICON_FAIL,                     // 26
+	PIX_ICON_PASS,                     // 27
+	PIX_ICON_CROSS,                    // 28
+	PIX_ICON_MEDIC_CROSS,              // 29
+	PIX_ICON_SQUARE,                   // 30
+	PIX_ICON_TRIANGLE,                 // 31
+	PIX_ICON_CIRCLE,                   // 32
+	PIX_ICON_RECTANGLE,                // 33
+	PIX_ICON_EXPORT,                   // 34
+	PIX_ICON_SAVE,                     // 35
+	PIX_ICON_CLOCK,                    // 36
+	PIX_ICON_STOPWATCH,                // 37
+	PIX_ICON_TV,                       // 38
+	PIX_ICON_COPY,                     // 39
+	PIX_ICON_DOCUMENT,                 // 40
+	PIX_ICON_SMARTPHONE,               // 41
+	PIX_ICON_BLUETOOTH,                // 42
+	PIX_ICON_AIRPLANE,                 // 43
+	PIX_ICON_GPS_PIN,                  // 44
+	PIX_ICON_STOCKS,                   // 45
+	PIX_ICON_TRUMP_STOCKS,             // 46
+	PIX_ICON_HOUSE,                    // 47
+	PIX_ICON_FLOWER,                   // 48
+	PIX_ICON_MUSIC_NOTE,               // 49
+	PIX_ICON_USB,                      // 50
+	PIX_ICON_SERIAL,                   // 51
+	PIX_ICON_MAGNIFYING_GLASS,         // 52
+	PIX_ICON_POWER,                    // 53
+	PIX_ICON_CONTACT,                  // 54
+	PIX_ICON_CALENDAR,                 // 55
+	PIX_ICON_WRENCH,                   // 56
+	PIX_ICON_POISON,                   // 57
+	PIX_ICON_GAS,                      // 58
+	PIX_ICON_TARGET,                   // 59
+	PIX_ICON_BULB,                     // 60
+	PIX_ICON_MALE,                     // 61
+	PIX_ICON_FEMALE,                   // 62
+	PIX_ICON_RIBBON,                   // 63
+	PIX_ICON_CAT,                      // 64
+	PIX_ICON_BONE,                     // 65
+	PIX_ICON_EVIL_CORP,                // 66
+	PIX_ICON_RUDE,                     // 67
+	PIX_ICON_PADLOCK,                  // 68
+	PIX_ICON_KEY,                      // 69
+	PIX_ICON_NFC,                      // 70
+	PIX_ICON_SYNC,                     // 71
+	PIX_ICON_INFO,                     // 72
+	PIX_ICON_HOURGLASS,                // 73
+	PIX_ICON_POINTER,                  // 74
+	PIX_ICON_CARET,                    // 75
+	PIX_ICON_LIKE,                     // 76
+	PIX_ICON_DISLIKE,                  // 77
+	PIX_ICON_REDDIT,                   // 78
+	PIX_ICON_OHM,                      // 79
+	PIX_ICON_ELECTRIC,                 // 80
+	PIX_ICON_ANTENNA,                  // 81
+	PIX_ICON_RESISTOR_US,              // 82
+	PIX_ICON_RESISTOR_EU,              // 83
+	PIX_ICON_CAPACITOR,                // 84
+	PIX_ICON_CAPACITOR_POL,            // 85
+	PIX_ICON_DIODE,                    // 86
+	PIX_ICON_ZENER,                    // 87
+	PIX_ICON_TRANSISTOR,               // 88
+	PIX_ICON_FUSE,                     // 89
+	PIX_ICON_INDUCTOR,                 // 90
+	PIX_ICON_SWITCH,                   // 91
+	PIX_ICON_SQUARE_WAVE,              // 92
+	PIX_ICON_TRIANGLE_WAVE,            // 93
+	PIX_ICON_SAWTOOTH_WAVE,            // 94
+	PIX_ICON_SINE_WAVE,                // 95
+	PIX_ICON_DC,                       // 96
+	PIX_ICON_ARDUINO,                  // 97
+	PIX_ICON_PLAY,                     // 98
+	PIX_ICON_PAUSE,                    // 99
+	PIX_ICON_FORWARD,                  // 100
+	PIX_ICON_REVERSE,                  // 101
+	PIX_ICON_SKIP_FORWARD,             // 102
+	PIX_ICON_SKIP_BACK,                // 103
+	PIX_ICON_DICE_1,                   // 104
+	PIX_ICON_DICE_2,                   // 105
+	PIX_ICON_DICE_3,                   // 106
+	PIX_ICON_DICE_4,                   // 107
+	PIX_ICON_DICE_5,                   // 108
+	PIX_ICON_DICE_6,                   // 109
+	PIX_ICON_RAIN,                     // 110
+	PIX_ICON_SNOW,                     // 111
+	PIX_ICON_SUNNY,                    // 112
+	PIX_ICON_CLOUDY,                   // 113
+	PIX_ICON_WINDY,                    // 114
+	PIX_ICON_MOON,                     // 115
+	PIX_ICON_STAR,                     // 116
+	PIX_ICON_ISS,                      // 117
+	PIX_ICON_SATELLITE,                // 118
+	PIX_ICON_METEOR,                   // 119
+	PIX_ICON_DITHER_1,                 // 120
+	PIX_ICON_DITHER_2,                 // 121
+	PIX_ICON_DITHER_3,                 // 122
+	PIX_ICON_DITHER_4,                 // 123
+	PIX_ICON_DITHER_5,                 // 124
+	PIX_ICON_DITHER_6,                 // 125
+	PIX_ICON_DITHER_7,                 // 126
+	PIX_ICON_DITHER_8,                 // 127
+	PIX_ICON_DITHER_9,                 // 128
+	PIX_ICON_DITHER_10,                // 129
+	PIX_ICON_DITHER_11,                // 130
+	PIX_ICON_DITHER_12,                // 131
+	PIX_ICON_DITHER_13,                // 132
+	PIX_ICON_DITHER_14,                // 133
+	PIX_ICON_DITHER_15,                // 134
+	PIX_ICON_DITHER_16,                // 135
+	PIX_ICON_SPINNER_1,                // 136
+	PIX_ICON_SPINNER_2,                // 137
+	PIX_ICON_SPINNER_3,                // 138
+	PIX_ICON_SPINNER_4,                // 139
+	PIX_ICON_SPINNER_5,                // 140
+	PIX_ICON_SPINNER_6,                // 141
+	PIX_ICON_SPINNER_7,                // 142
+	PIX_ICON_SPINNER_8,                // 143
+	PIX_ICON_SPINNER_9,                // 144
+	PIX_ICON_SPINNER_10,               // 145
+	PIX_ICON_D_QUOTE_LEFT,             // 146
+	PIX_ICON_D_QUOTE_RIGHT,            // 147
+	PIX_ICON_D_QUOTE_RIGHT_2,          // 148
+	PIX_ICON_D_QUOTE_L_UNDER,          // 149
+	PIX_ICON_D_QUOTE_R_UNDER,          // 150
+	PIX_ICON_QUOTE_LEFT,               // 151
+	PIX_ICON_QUOTE_RIGHT,              // 152
+	PIX_ICON_QUOTE_RIGHT_2,            // 153
+	PIX_ICON_QUOTE_L_UNDER,            // 154
+	PIX_ICON_QUOTE_R_UNDER,            // 155
+	PIX_ICON_ANGLE_QUOTE_L,            // 156
+	PIX_ICON_ANGLE_QUOTE_R,            // 157
+	PIX_ICON_DEGREES,                  // 158
+	PIX_ICON_BITCOIN,                  // 159
+	PIX_ICON_CENTS,                    // 160
+	PIX_ICON_EURO,                     // 161
+	PIX_ICON_GBP,                      // 162
+	PIX_ICON_YUAN,                     // 163
+	PIX_ICON_RMB,                      // 164
+	PIX_ICON_JPY,                      // 165
+	PIX_ICON_TRY,                      // 166
+	PIX_ICON_CHF,                      // 167
+	PIX_ICON_RUB,                      // 168
+	PIX_ICON_INR,                      // 169
+	PIX_ICON_MICRO,                    // 170
+	PIX_ICON_PI,                       // 171
+	PIX_ICON_COPYRIGHT,                // 172
+	PIX_ICON_ELLIPSIS,                 // 173
+	PIX_ICON_A_ACUTE,                  // 174
+	PIX_ICON_A_CEDILLA,                // 175
+	PIX_ICON_A_CIRCUMFLEX,             // 176
+	PIX_ICON_A_GRAVE,                  // 177
+	PIX_ICON_A_MACRON,                 // 178
+	PIX_ICON_A_OVERDOT,                // 179
+	PIX_ICON_A_TILDE,                  // 180
+	PIX_ICON_A_UMLAUT,                 // 181
+	PIX_ICON_E_ACUTE,                  // 182
+	PIX_ICON_E_CEDILLA,                // 183
+	PIX_ICON_E_CIRCUMFLEX,             // 184
+	PIX_ICON_E_GRAVE,                  // 185
+	PIX_ICON_E_MACRON,                 // 186
+	PIX_ICON_E_UMLAUT,                 // 187
+	PIX_ICON_I_ACUTE,                  // 188
+	PIX_ICON_I_CIRCUMFLEX,             // 189
+	PIX_ICON_I_GRAVE,                  // 190
+	PIX_ICON_I_MACRON,                 // 191
+	PIX_ICON_I_UMLAUT,                 // 192
+	PIX_ICON_O_ACUTE,                  // 193
+	PIX_ICON_O_CIRCUMFLEX,             // 194
+	PIX_ICON_O_GRAVE,                  // 195
+	PIX_ICON_O_MACRON,                 // 196
+	PIX_ICON_O_TILDE,                  // 197
+	PIX_ICON_O_UMLAUT,                 // 198
+	PIX_ICON_U_ACUTE,                  // 199
+	PIX_ICON_U_CIRCUMFLEX,             // 200
+	PIX_ICON_U_GRAVE,                  // 201
+	PIX_ICON_U_MACRON,                 // 202
+	PIX_ICON_U_UMLAUT,                 // 203
+	PIX_ICON_C_ACUTE,                  // 204
+	PIX_ICON_C_CARON,                  // 205
+	PIX_ICON_C_CEDILLA,                // 206
+	PIX_ICON_L_CEDILLA,                // 207
+	PIX_ICON_N_ACUTE,                  // 208
+	PIX_ICON_N_CEDILLA,                // 209
+	PIX_ICON_N_TILDE,                  // 210
+	PIX_ICON_S_ACUTE,                  // 211
+	PIX_ICON_S_CARON,                  // 212
+	PIX_ICON_Y_UMLAUT,                 // 213
+	PIX_ICON_Z_ACUTE,                  // 214
+	PIX_ICON_Z_CARON,                  // 215
+	PIX_ICON_Z_OVERDOT,                // 216
+	PIX_ICON_ESZETT,                   // 217
+	PIX_ICON_L_SLAVIC,                 // 218
+	PIX_ICON_ETH_UPPER,                // 219
+	PIX_ICON_ETH_LOWER,                // 220
+	PIX_ICON_THORN,                    // 221
+};
+
+const uint8_t pix_icons_data[972] PROGMEM = {
+	0x04, 0xC1, 0x5F, 0x40, 0xF0, 0x18, 0x14, 0x12, 0x10, 0x48, 0xA2, 0x30, 0x78, 0x20, 0xA0, 0x3F,
+	0x08, 0xC2, 0x83, 0xA1, 0x48, 0x02, 0x01, 0x09, 0x05, 0xE3, 0x21, 0x38, 0x2A, 0x04, 0x02, 0x81,
+	0x50, 0x71, 0x10, 0x24, 0x17, 0x89, 0x84, 0xC1, 0x90, 0x48, 0x2E, 0x92, 0x27, 0x90, 0x8B, 0xB9,
+	0x20, 0x18, 0x0E, 0x06, 0x42, 0x60, 0x70, 0x18, 0x04, 0x00, 0x82, 0xE3, 0x03, 0x00, 0x7C, 0x1C,
+	0x04, 0x80, 0x21, 0x21, 0x49, 0x18, 0x10, 0x13, 0xC8, 0x04, 0x01, 0x59, 0x20, 0x16, 0x90, 0x45,
+	0x04, 0x12, 0x59, 0x88, 0x26, 0x90, 0x89, 0x98, 0x54, 0x81, 0x54, 0x49, 0x8E, 0x4C, 0x65, 0xE2,
+	0x70, 0x6C, 0x36, 0x1B, 0xC7, 0x67, 0x52, 0x99, 0x7C, 0x80, 0xF1, 0xDD, 0x07, 0x90, 0x24, 0xD3,
+	0x49, 0x89, 0x88, 0x82, 0xA0, 0x88, 0x20, 0x20, 0x08, 0x82, 0x40, 0x20, 0xFC, 0x09, 0x04, 0x8E,
+	0x4D, 0x64, 0xE3, 0xF8, 0x44, 0x22, 0x91, 0x0F, 0x86, 0x22, 0xA1, 0x60, 0x1C, 0x91, 0x48, 0xC4,
+	0xF9, 0x07, 0x83, 0xC1, 0x3F, 0x5D, 0xF8, 0x15, 0xD2, 0x7D, 0x22, 0x97, 0x89, 0xC7, 0x11, 0xB9,
+	0x64, 0x1C, 0x5C, 0xF3, 0x5E, 0xC4, 0xF5, 0x8D, 0x44, 0x63, 0xFF, 0x91, 0x4B, 0xBD, 0x78, 0x38,
+	0x96, 0x4B, 0xE4, 0xF3, 0x05, 0xC3, 0x41, 0x1F, 0x05, 0xF1, 0x57, 0x51, 0x10, 0xC4, 0x3F, 0x11,
+	0xE1, 0x88, 0x94, 0x23, 0x0E, 0x30, 0x04, 0x84, 0x31, 0x18, 0x30, 0x20, 0x08, 0x18, 0x41, 0x13,
+	0xDD, 0x10, 0x80, 0x4B, 0xFF, 0x04, 0x20, 0x08, 0x7E, 0x70, 0x10, 0x06, 0xF4, 0x47, 0x18, 0x00,
+	0x2A, 0x40, 0x15, 0xE0, 0x88, 0xC4, 0x23, 0x0E, 0x1C, 0xD1, 0x4B, 0xC4, 0xB9, 0xE3, 0xF1, 0xB8,
+	0xDB, 0x67, 0x32, 0x99, 0x7C, 0x86, 0x3F, 0xFF, 0x6F, 0x90, 0x96, 0x4A, 0x25, 0x69, 0xC6, 0x0C,
+	0xC8, 0x98, 0x39, 0x22, 0x95, 0x88, 0xE3, 0x88, 0x87, 0xE3, 0x0E, 0x92, 0xF4, 0x2B, 0x25, 0x99,
+	0x52, 0xF9, 0x94, 0xC9, 0x98, 0x8A, 0xA4, 0x8C, 0x3E, 0x2A, 0x99, 0xEA, 0x1B, 0xFF, 0x7D, 0xFF,
+	0xB1, 0xC1, 0x87, 0xF3, 0x19, 0x20, 0x78, 0x3F, 0x1E, 0x86, 0x77, 0x26, 0x9D, 0x78, 0xC0, 0xA1,
+	0x7F, 0x05, 0xFC, 0x84, 0x94, 0x90, 0xFF, 0x0F, 0xA2, 0x08, 0xFE, 0xBE, 0x7F, 0xF1, 0xEF, 0x1B,
+	0x57, 0x93, 0xD5, 0xF1, 0x5F, 0x44, 0xC3, 0x42, 0x82, 0x41, 0x5F, 0x30, 0x88, 0xE3, 0xEB, 0xF1,
+	0x30, 0x8E, 0xCF, 0xEB, 0x61, 0xC0, 0x90, 0x4E, 0x25, 0xCC, 0x19, 0x0F, 0xC4, 0x9D, 0x0C, 0xE7,
+	0x6B, 0x93, 0x18, 0x14, 0xFE, 0x85, 0x01, 0x80, 0xB0, 0x86, 0x00, 0x00, 0xBE, 0xB1, 0x0F, 0x40,
+	0xA1, 0xDC, 0x29, 0x14, 0x12, 0xE5, 0x4E, 0x21, 0x91, 0x68, 0x6F, 0x1A, 0x49, 0x44, 0x7B, 0xD3,
+	0x50, 0x08, 0x1F, 0x65, 0x0C, 0xF0, 0x89, 0xFE, 0x22, 0x1F, 0x40, 0xB5, 0xA6, 0x00, 0x00, 0x73,
+	0x02, 0x02, 0xE0, 0x10, 0xF8, 0x40, 0x38, 0x04, 0x01, 0x01, 0x41, 0x20, 0x08, 0x3E, 0x08, 0x82,
+	0x21, 0xE0, 0x80, 0x30, 0x14, 0x02, 0x85, 0x40, 0x41, 0x50, 0x10, 0x14, 0x84, 0x8F, 0xC3, 0x41,
+	0x00, 0x7C, 0x3E, 0x80, 0xCF, 0xE7, 0xE3, 0xF8, 0x38, 0x08, 0x04, 0xC7, 0xC7, 0xF1, 0xF9, 0x38,
+	0x08, 0x9F, 0xCF, 0xE7, 0x43, 0x70, 0x7C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+	0x08, 0x80, 0x00, 0x08, 0x44, 0x00, 0x00, 0x40, 0x24, 0x02, 0x20, 0x00, 0x22, 0x15, 0x00, 0x00,
+	0x50, 0xC1, 0x90, 0x44, 0xE1, 0x4F, 0x85, 0xB0, 0x21, 0x54, 0x2A, 0x8E, 0x8F, 0xA3, 0x42, 0x91,
+	0x48, 0xAB, 0x09, 0x4A, 0x95, 0xAA, 0x28, 0x40, 0x20, 0x98, 0x8F, 0xA3, 0x42, 0xF8, 0x10, 0xAA,
+	0x6A, 0xF5, 0x9F, 0xEC, 0xFA, 0x7C, 0x08, 0x9F, 0xCF, 0x95, 0x20, 0x08, 0x04, 0x80, 0x08, 0x00,
+	0x00, 0x00, 0x10, 0x01, 0x11, 0x00, 0xA0, 0x0A, 0x20, 0x02, 0x00, 0x55, 0x40, 0x15, 0x20, 0xAA,
+	0x02, 0xAA, 0x22, 0x51, 0x15, 0x51, 0x15, 0xA9, 0xAA, 0x88, 0xAA, 0x4A, 0x55, 0x55, 0x55, 0x55,
+	0xAA, 0xAA, 0xEA, 0xAE, 0x52, 0xDD, 0x55, 0x5D, 0x95, 0xAA, 0xAA, 0xFA, 0xAB, 0x54, 0x7F, 0xD5,
+	0x5F, 0xB5, 0xFB, 0xAB, 0xFE, 0xBB, 0xDD, 0xDF, 0xFD, 0xDF, 0xB9, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x80, 0x39, 0x03, 0x00, 0x10, 0x86, 0x30, 0x04,
+	0x40, 0x10, 0x04, 0x41, 0x00, 0x41, 0x20, 0x10, 0x04, 0x04, 0x02, 0x81, 0x40, 0x10, 0x10, 0x08,
+	0x04, 0x44, 0x40, 0x40, 0x40, 0x40, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x38, 0x60, 0x80, 0xA3,
+	0x01, 0x70, 0x34, 0x1A, 0x0E, 0x40, 0xC3, 0xB1, 0x38, 0x00, 0x16, 0x07, 0x38, 0x1A, 0x00, 0x47,
+	0xA3, 0xE1, 0x00, 0x34, 0x1C, 0x00, 0x00, 0x38, 0x1A, 0x0D, 0x07, 0x00, 0x00, 0x58, 0x1C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xA3, 0xD1, 0x70, 0x00, 0x00, 0x80, 0xA0, 0x88, 0x10, 0x14, 0x0A,
+	0x42, 0x44, 0x41, 0x08, 0x0A, 0x02, 0x00, 0xC0, 0xB7, 0x56, 0xAD, 0x29, 0x1C, 0xD1, 0x58, 0x44,
+	0xA1, 0xF8, 0xAA, 0xD5, 0x20, 0xD2, 0x97, 0x4C, 0x0A, 0x03, 0x2A, 0xBE, 0x2A, 0x40, 0xEC, 0x15,
+	0xFA, 0xC4, 0x80, 0x82, 0xAF, 0x08, 0x28, 0xFE, 0x4A, 0x10, 0x04, 0xF2, 0xAF, 0x54, 0x0A, 0xA8,
+	0x7F, 0x2A, 0x65, 0xA8, 0x54, 0x2A, 0xAF, 0x22, 0x80, 0x0F, 0x02, 0x71, 0x88, 0x3C, 0x02, 0x9F,
+	0x00, 0xE0, 0x50, 0x28, 0x00, 0x10, 0x00, 0x04, 0x00, 0x81, 0xA8, 0xD6, 0x2A, 0x1E, 0x51, 0xAD,
+	0x55, 0x3C, 0x20, 0x6B, 0xD5, 0x8A, 0x07, 0x51, 0xAB, 0x56, 0x3C, 0xA8, 0x5A, 0xAD, 0xE2, 0x41,
+	0xD4, 0x2A, 0x15, 0x2F, 0xAA, 0x5A, 0xAB, 0x78, 0x50, 0x95, 0x5A, 0xC5, 0xE3, 0xAC, 0x55, 0x2A,
+	0xC6, 0x51, 0xAD, 0x55, 0x0C, 0x38, 0x6B, 0xD5, 0x8A, 0xC1, 0x51, 0xAB, 0x56, 0x0C, 0xAE, 0x5A,
+	0xAD, 0x62, 0x70, 0x55, 0x6A, 0x15, 0x03, 0x00, 0xE8, 0x03, 0x00, 0x80, 0x20, 0x2F, 0x00, 0x00,
+	0x02, 0x7A, 0x00, 0x00, 0x20, 0xD0, 0x0B, 0x00, 0x00, 0x01, 0x5E, 0x00, 0xC0, 0x11, 0x8D, 0x45,
+	0x1C, 0xCE, 0x58, 0x34, 0xE2, 0x70, 0x45, 0x23, 0x11, 0x87, 0x2B, 0x16, 0x8B, 0x38, 0x5D, 0xD1,
+	0x58, 0xC4, 0xE1, 0x8A, 0xC4, 0x22, 0x8E, 0x07, 0x14, 0x86, 0xF8, 0x38, 0x61, 0x50, 0x84, 0xE7,
+	0x05, 0x85, 0x20, 0x3E, 0x2F, 0x18, 0x0C, 0xF1, 0x79, 0x41, 0x60, 0x88, 0x0F, 0x53, 0x26, 0x91,
+	0x00, 0x58, 0x52, 0x99, 0x04, 0x30, 0xA4, 0x32, 0x09, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x7C, 0x84,
+	0xA1, 0x80, 0xFF, 0x08, 0x43, 0x01, 0x8F, 0x3E, 0xA2, 0x48, 0xC0, 0x91, 0x54, 0x6B, 0x95, 0x84,
+	0xAC, 0x5A, 0xAB, 0x24, 0x46, 0x14, 0x1A, 0xE5, 0x11, 0xC9, 0xD6, 0x26, 0x91, 0x58, 0xB6, 0x36,
+	0x89, 0x44, 0x72, 0x95, 0x49, 0xF4, 0x07, 0x8A, 0x4A, 0x18, 0x08, 0xF2, 0x27, 0x08, 0x92, 0xFF,
+	0x64, 0xD0, 0x07, 0xA8, 0x29, 0x9B, 0xB8, 0xBF, 0x44, 0x22, 0x61, 0x00,
+};
+
+const PixieAssets PIX_ICONS = {pix_icons_data, NULL, 222, 5, PIX_PACK7};
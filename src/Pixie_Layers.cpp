@@ -0,0 +1,401 @@
+/*!
+ * @file Pixie_Layers.cpp
+ *
+ * Windows with their own content and scroll state, composited onto a Pixie chain.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Layers.h"
+
+// Widens the column range **first** to **last** (empty if first > last) to
+// take in **a** to **b**
+static void widen(int16_t& first, int16_t& last, int16_t a, int16_t b){
+	if(first > last){
+		first = a;
+		last  = b;
+		return;
+	}
+	if(a < first){
+		first = a;
+	}
+	if(b > last){
+		last = b;
+	}
+}
+
+/**************************************************************************/
+/*!
+	Creates a window on a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieLayers layers(pix);
+	PixieLayer clock_field(pix, 0, 25);       // Positions 0-4
+	PixieLayer ticker(pix, 30, 30, 200);      // Positions 6-11, 200 columns to scroll through
+	</pre>
+	then layers.add(clock_field); layers.add(ticker); in setup().
+
+    @param	display	Chain the layer is drawn on, for its fonts
+	@param	x		Chain column of the window's left edge, can be negative
+	@param	width	Window width in columns
+	@param	content	Columns of content, at least **width** (the default)
+*/
+/**************************************************************************/
+PixieLayer::PixieLayer(Pixie& display, int16_t x, uint8_t width, uint16_t content){
+	pix = &display;
+	if(content < width){
+		content = width;
+	}
+	if(content == 0){
+		content = 1;
+	}
+	content_w = content;
+	at_x  = x;
+	win_w = width;
+	cols  = new uint8_t[content_w];
+	memset(cols, 0, content_w);
+}
+
+PixieLayer::~PixieLayer(){
+	delete[] cols;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Blanks the layer's content. What is under it stays covered
+	until set_visible(false) or PixieLayers::remove().
+*/
+/**************************************************************************/
+void PixieLayer::clear(){
+	memset(cols, 0, content_w);
+	mark_window();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets content column **x** to **col** (bit 0 at the top). Only a
+	change that shows in the window marks the chain.
+*/
+/**************************************************************************/
+void PixieLayer::put_column(int16_t x, uint8_t col){
+	if(x < 0 || x >= (int16_t)content_w){
+		return;
+	}
+	col &= 0x7F;
+	if(cols[x] == col){
+		return;
+	}
+	cols[x] = col;
+	int16_t w = x - offset; // Window column, with the content wrapping around
+	if(w < 0){
+		w += content_w;
+	}
+	if(w < win_w){
+		mark(at_x + w, at_x + w);
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns content column **x**, 0 outside the content
+*/
+/**************************************************************************/
+uint8_t PixieLayer::get_column(int16_t x){
+	if(x < 0 || x >= (int16_t)content_w){
+		return 0;
+	}
+	return cols[x];
+}
+
+/**************************************************************************/
+/*!
+    @brief	Renders a UTF-8 string in the 5 column font into the content,
+	starting at content column **x**, clipped to the content
+
+    @return	Width of the text in columns
+*/
+/**************************************************************************/
+uint16_t PixieLayer::draw_text(char* input, int16_t x){
+	int16_t start = x;
+	while(*input != 0){
+		const uint8_t* src = pix->next_glyph(input);
+		for(uint8_t c = 0; c < 5; c++){
+			put_column(x + c, pgm_read_byte(src + c));
+		}
+		x += 5;
+	}
+	return x - start;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Copies **width** PROGMEM columns into the content at content
+	column **x**, like Pixie::draw_P()
+
+    @return	**width**
+*/
+/**************************************************************************/
+uint16_t PixieLayer::draw_P(const uint8_t* columns, uint16_t width, int16_t x){
+	for(uint16_t c = 0; c < width; c++){
+		put_column(x + c, pgm_read_byte(columns + c));
+	}
+	return width;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Limits the layer to rows **y** to **y**+**h**-1. Rows outside
+	them show what is under the layer.
+*/
+/**************************************************************************/
+void PixieLayer::set_rows(uint8_t y, uint8_t h){
+	uint8_t mask = 0;
+	if(y < 7){
+		mask = (h >= 7 ? 0x7F : (1 << h) - 1) << y;
+	}
+	mask &= 0x7F;
+	if(mask != rows){
+		rows = mask;
+		mark_window();
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves the window's left edge to chain column **x**
+*/
+/**************************************************************************/
+void PixieLayer::move(int16_t x){
+	if(x == at_x){
+		return;
+	}
+	mark_window(); // Uncovered where it was
+	at_x = x;
+	mark_window();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Shows the content from column **offset** at the window's left
+	edge. Past the end of the content it wraps around to column 0.
+*/
+/**************************************************************************/
+void PixieLayer::scroll_to(uint16_t offset){
+	offset %= content_w;
+	if(offset != this->offset){
+		this->offset = offset;
+		mark_window();
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Scrolls the content **dx** columns to the left (right if
+	negative), wrapping around. A ticker calls scroll(1) once per step.
+*/
+/**************************************************************************/
+void PixieLayer::scroll(int16_t dx){
+	int32_t o = ((int32_t)offset + dx) % content_w;
+	if(o < 0){
+		o += content_w;
+	}
+	scroll_to(o);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Hides or shows the layer without removing it from its stack
+*/
+/**************************************************************************/
+void PixieLayer::set_visible(bool visible){
+	if(visible != shown){
+		shown = visible;
+		mark_window();
+	}
+}
+
+// Adds chain columns **first** to **last** to the ones to compose again
+void PixieLayer::mark(int16_t first, int16_t last){
+	widen(dirty_first, dirty_last, first, last);
+}
+
+void PixieLayer::mark_window(){
+	if(win_w > 0){
+		mark(at_x, at_x + win_w - 1);
+	}
+}
+
+/**************************************************************************/
+/*!
+	Creates an empty stack of layers for a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieLayers layers(pix);
+	</pre>
+	then add() layers in setup(), and in loop() draw into them and call
+	layers.show() instead of pix.show().
+*/
+/**************************************************************************/
+PixieLayers::PixieLayers(Pixie& display){
+	pix = &display;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Adds **layer** to the stack at depth **z**, above the layers with
+	a lower or equal z. Adding a layer that is already in the stack moves
+	it to **z**.
+
+    @return	False if the stack already holds PIX_MAX_LAYERS layers
+*/
+/**************************************************************************/
+bool PixieLayers::add(PixieLayer& layer, uint8_t z){
+	remove(layer);
+	if(count == PIX_MAX_LAYERS){
+		return false;
+	}
+	uint8_t i = count;
+	while(i > 0 && stack[i-1]->z > z){
+		stack[i] = stack[i-1];
+		i--;
+	}
+	stack[i] = &layer;
+	count++;
+	layer.z = z;
+	layer.mark_window();
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Takes **layer** off the stack. The next compose() redraws what
+	it covered from the layers under it.
+*/
+/**************************************************************************/
+void PixieLayers::remove(PixieLayer& layer){
+	for(uint8_t i = 0; i < count; i++){
+		if(stack[i] != &layer){
+			continue;
+		}
+		for(; i+1 < count; i++){
+			stack[i] = stack[i+1];
+		}
+		count--;
+		widen(dirty_first, dirty_last, layer.at_x, layer.at_x + layer.win_w - 1);
+		if(layer.dirty_first <= layer.dirty_last){ // Where it was before a move() not yet composed
+			widen(dirty_first, dirty_last, layer.dirty_first, layer.dirty_last);
+		}
+		layer.dirty_first = 0;
+		layer.dirty_last  = -1;
+		return;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Puts **overlay** on top of every layer, for a notification or
+	similar. The layers under it keep their content, so pop() brings them
+	back without drawing them again.
+*/
+/**************************************************************************/
+bool PixieLayers::push(PixieLayer& overlay){
+	return add(overlay, PIX_Z_TOP);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Takes the top layer off the stack
+
+    @return	The layer, or NULL if the stack is empty
+*/
+/**************************************************************************/
+PixieLayer* PixieLayers::pop(){
+	if(count == 0){
+		return NULL;
+	}
+	PixieLayer* top = stack[count-1];
+	remove(*top);
+	return top;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Merges the columns the layers changed since the last compose()
+	into the Pixie's frame and marks them for Pixie::show_changes(). Only
+	those columns are touched, each costs one masked write per layer
+	covering it.
+
+    @return	True if any column was composed
+*/
+/**************************************************************************/
+bool PixieLayers::compose(){
+	int16_t first = dirty_first;
+	int16_t last  = dirty_last;
+	dirty_first = 0;
+	dirty_last  = -1;
+	for(uint8_t i = 0; i < count; i++){
+		PixieLayer* l = stack[i];
+		if(l->dirty_first > l->dirty_last){
+			continue;
+		}
+		widen(first, last, l->dirty_first, l->dirty_last);
+		l->dirty_first = 0;
+		l->dirty_last  = -1;
+	}
+	if(first < 0){
+		first = 0;
+	}
+	if(first > last){
+		return false;
+	}
+
+	uint8_t buf[32]; // Composed a chunk at a time, layer by layer
+	for(int16_t x0 = first; x0 <= last; x0 += sizeof(buf)){
+		int16_t x1 = x0 + sizeof(buf) - 1;
+		if(x1 > last){
+			x1 = last;
+		}
+		memset(buf, 0, x1 - x0 + 1);
+		for(uint8_t i = 0; i < count; i++){
+			PixieLayer* l = stack[i];
+			int16_t a = l->at_x;
+			int16_t b = l->at_x + l->win_w - 1;
+			if(a < x0){
+				a = x0;
+			}
+			if(b > x1){
+				b = x1;
+			}
+			if(!l->shown || a > b){
+				continue;
+			}
+			uint16_t c = l->offset + (a - l->at_x);
+			if(c >= l->content_w){
+				c -= l->content_w;
+			}
+			uint8_t keep = ~l->rows;
+			for(int16_t x = a; x <= b; x++){
+				buf[x - x0] = (buf[x - x0] & keep) | (l->cols[c] & l->rows);
+				if(++c == l->content_w){
+					c = 0;
+				}
+			}
+		}
+		for(int16_t x = x0; x <= x1; x++){
+			pix->write_byte(buf[x - x0], x);
+		}
+	}
+	pix->mark_dirty(first, last - first + 1);
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	compose(), then Pixie::show_changes()
+
+    @return	True if anything was sent
+*/
+/**************************************************************************/
+bool PixieLayers::show(){
+	compose();
+	return pix->show_changes();
+}
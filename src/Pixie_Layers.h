@@ -0,0 +1,88 @@
+/*!
+ * @file Pixie_Layers.h
+ *
+ * Windows with their own content and scroll state, composited onto a Pixie chain.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_layers_h
+#define pixie_layers_h
+#include "Pixie.h"
+
+#define PIX_MAX_LAYERS 8   // Layers one PixieLayers can stack
+#define PIX_Z_TOP      255 // z of overlays from PixieLayers::push()
+
+class PixieLayers;
+
+/**************************************************************************/
+/*!
+    @brief	A window on a Pixie chain: **width** columns starting at column
+	**x**, over some or all of the 7 rows. It keeps its own columns, which
+	can be wider than the window and scrolled through it, wrapping around.
+	Drawing only changes the layer and notes which columns of the chain
+	changed; PixieLayers::compose() puts them on the chain.
+*/
+/**************************************************************************/
+class PixieLayer{
+  public:
+	PixieLayer(Pixie& display, int16_t x, uint8_t width, uint16_t content = 0);
+	~PixieLayer();
+	void clear();
+	void put_column(int16_t x, uint8_t col);
+	uint8_t get_column(int16_t x);
+	uint16_t draw_text(char* input, int16_t x);
+	uint16_t draw_P(const uint8_t* columns, uint16_t width, int16_t x);
+	template<uint16_t W> uint16_t draw_text(const PixieText<W>& text, int16_t x){
+		return draw_P(text.columns, W, x);
+	}
+	void set_rows(uint8_t y, uint8_t h);
+	void move(int16_t x);
+	void scroll_to(uint16_t offset);
+	void scroll(int16_t dx);
+	void set_visible(bool visible);
+
+  private:
+	friend class PixieLayers;
+	void mark(int16_t first, int16_t last);
+	void mark_window();
+
+	Pixie* pix;
+	uint8_t* cols;             // Content columns, bit 0 at the top
+	uint16_t content_w;
+	int16_t  at_x;             // Chain column of the window's left edge
+	uint8_t  win_w;
+	uint16_t offset   = 0;     // Content column at the window's left edge
+	uint8_t  rows     = 0x7F;  // Rows the layer covers
+	bool     shown    = true;
+	uint8_t  z        = 0;
+	int16_t  dirty_first = 0;  // Chain columns to compose again, empty if first > last
+	int16_t  dirty_last  = -1;
+};
+
+/**************************************************************************/
+/*!
+    @brief	Stacks PixieLayers on a Pixie chain in z order and merges the
+	columns they changed into its frame. Each column is the layers that
+	cover it, bottom to top, each replacing the rows it covers. Columns no
+	visible layer covers are blank once composed.
+*/
+/**************************************************************************/
+class PixieLayers{
+  public:
+	PixieLayers(Pixie& display);
+	bool add(PixieLayer& layer, uint8_t z = 0);
+	void remove(PixieLayer& layer);
+	bool push(PixieLayer& overlay);
+	PixieLayer* pop();
+	bool compose();
+	bool show();
+
+  private:
+	Pixie* pix;
+	PixieLayer* stack[PIX_MAX_LAYERS]; // Bottom to top
+	uint8_t count = 0;
+	int16_t dirty_first = 0;           // Columns uncovered by remove()
+	int16_t dirty_last  = -1;
+};
+
+#endif
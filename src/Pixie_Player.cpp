@@ -0,0 +1,166 @@
+/*!
+ * @file Pixie_Player.cpp
+ *
+ * Non-blocking player for delta-encoded PROGMEM animations.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Player.h"
+
+/**************************************************************************/
+/*!
+	Attaches a player to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixiePlayer player(pix);
+	</pre>
+	then player.begin(PIX_ANIM_SPINNER); and in loop():
+	if(player.update()){ pix.show_changes(); }
+*/
+/**************************************************************************/
+PixiePlayer::PixiePlayer(Pixie& display){
+	pix = &display;
+}
+
+PixiePlayer::~PixiePlayer(){
+	delete[] cols;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Starts an animation, drawing its first frame right away
+	
+    @param	anim	Animation to play, made by extras/pack_animation.py
+	@param	x		Column of the animation's left edge, can be negative
+	@param	loop	Start over after the last frame, or stop on it
+*/
+/**************************************************************************/
+void PixiePlayer::begin(const PixieAnimation& anim, int16_t x, bool loop){
+	if(anim.width > cols_size){ // Only grows, so switching animations doesn't fragment the heap
+		delete[] cols;
+		cols = new uint8_t[anim.width];
+		cols_size = anim.width;
+	}
+	this->anim = &anim;
+	at_x    = x;
+	looping = loop;
+	playing = true;
+	current = 0;
+	memcpy_P(cols, anim.data, anim.width);
+	delta = anim.data + anim.width;
+	frame_start = millis();
+	draw();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws the whole current frame again, for after clear() or
+	anything else drawn over it
+*/
+/**************************************************************************/
+void PixiePlayer::draw(){
+	if(anim == NULL){
+		return;
+	}
+	for(uint8_t c = 0; c < anim->width; c++){
+		if(at_x + c >= 0){
+			pix->write_byte(cols[c], at_x + c);
+		}
+	}
+	pix->mark_dirty(at_x, anim->width);
+}
+
+// ms frame **f** stays up
+uint16_t PixiePlayer::duration(uint16_t f){
+	if(anim->durations != NULL){
+		return pgm_read_word(anim->durations + f);
+	}
+	return anim->frame_ms;
+}
+
+// Applies the delta after **current**: XORs each listed column, writes it and
+// marks its module. Unchanged columns cost one bit of the bitmap.
+void PixiePlayer::apply_delta(){
+	uint8_t mask_bytes = (anim->width + 7) / 8;
+	const uint8_t* xor_src = delta + mask_bytes;
+	for(uint8_t m = 0; m < mask_bytes; m++){
+		uint8_t mask = pgm_read_byte(delta + m);
+		uint8_t c = m*8;
+		for(; mask != 0; mask >>= 1, c++){
+			if(mask & 1){
+				cols[c] ^= pgm_read_byte(xor_src++);
+				int16_t x = at_x + c;
+				if(x >= 0){
+					pix->write_byte(cols[c], x);
+					pix->mark_dirty(x, 1);
+				}
+			}
+		}
+	}
+	if(++current == anim->frames){
+		current = 0;
+		delta = anim->data + anim->width;
+	}
+	else{
+		delta = xor_src;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves on to the frame that is due by now, applying the delta of
+	every frame in between. Nothing is sent, follow it with show_changes()
+	(or show()). Call this as often as possible from loop().
+	
+    @return	True if the frame changed
+*/
+/**************************************************************************/
+bool PixiePlayer::update(){
+	if(!playing){
+		return false;
+	}
+	uint32_t now = millis();
+	uint16_t steps = 0;
+	while(now - frame_start >= duration(current)){
+		if(!looping && current == anim->frames-1){
+			playing = false;
+			break;
+		}
+		if(steps == anim->frames){ // A whole loop behind (or 0 ms frames): catch up in one go
+			frame_start = now;
+			break;
+		}
+		frame_start += duration(current);
+		apply_delta();
+		steps++;
+	}
+	return steps != 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns true once a non-looping animation has shown its last
+	frame for its duration, or if nothing was started
+*/
+/**************************************************************************/
+bool PixiePlayer::done(){
+	return !playing;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Stops on the current frame
+*/
+/**************************************************************************/
+void PixiePlayer::stop(){
+	playing = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the number of the frame on the displays, 0 is the keyframe
+*/
+/**************************************************************************/
+uint16_t PixiePlayer::frame(){
+	return current;
+}
@@ -0,0 +1,46 @@
+/*!
+ * @file Pixie_Player.h
+ *
+ * Non-blocking player for delta-encoded PROGMEM animations.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_player_h
+#define pixie_player_h
+#include "Pixie.h"
+
+/**************************************************************************/
+/*! 
+    @brief	Plays a PixieAnimation at a spot on a Pixie chain from the main
+	loop. Each frame change only touches the columns the animation's delta
+	lists, and marks only their modules for Pixie::show_changes().
+*/
+/**************************************************************************/
+class PixiePlayer{
+  public:
+	PixiePlayer(Pixie& display);
+	~PixiePlayer();
+	void begin(const PixieAnimation& anim, int16_t x = 0, bool loop = true);
+	bool update();
+	void draw();
+	bool done();
+	void stop();
+	uint16_t frame();
+	
+  private:
+	uint16_t duration(uint16_t f);
+	void apply_delta();
+	
+	Pixie* pix;
+	const PixieAnimation* anim = NULL;
+	int16_t  at_x = 0;
+	bool     looping = true;
+	bool     playing = false;
+	uint16_t current = 0;     // Frame on the displays
+	const uint8_t* delta = NULL; // Delta from **current** to the next frame
+	uint32_t frame_start = 0;
+	uint8_t* cols = NULL;     // Columns of **current**
+	uint8_t  cols_size = 0;
+};
+
+#endif
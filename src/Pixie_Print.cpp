@@ -0,0 +1,109 @@
+/*!
+ * @file Pixie_Print.cpp
+ *
+ * Arduino Print adapter for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Print.h"
+
+/**************************************************************************/
+/*!
+	Attaches a Print adapter to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixiePrint out(pix);
+	</pre>
+	then out.print(F("Temp ")); out.print(t, 1); pix.show();
+*/
+/**************************************************************************/
+PixiePrint::PixiePrint(Pixie& display, uint8_t mode){
+	pix = &display;
+	print_mode = mode;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Sets where characters go: PIX_PRINT_CURSOR writes them at the
+	cursor (see set_cursor()), PIX_PRINT_PUSH pushes them in from the right.
+*/
+/**************************************************************************/
+void PixiePrint::set_mode(uint8_t mode){
+	print_mode = mode;
+	utf8_len  = 0;
+	utf8_need = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws one byte of text, the only function Print needs. '\r' is
+	skipped and '\n' moves the cursor back to position 0, so println()
+	starts the next line over the last one. Call show() to display it.
+	
+    @return	1, the byte was taken
+*/
+/**************************************************************************/
+size_t PixiePrint::write(uint8_t c){
+	if(utf8_need != 0){
+		if((c & 0xC0) == 0x80){
+			utf8[utf8_len++] = c;
+			if(--utf8_need == 0){
+				utf8[utf8_len] = 0;
+				char* p = utf8;
+				put_glyph(pix->next_glyph(p));
+				utf8_len = 0;
+			}
+			return 1;
+		}
+		for(uint8_t i = 0; i < utf8_len; i++){ // Cut short: show the bytes as Latin-1
+			put_glyph(pix->glyph(utf8[i]));
+		}
+		utf8_len  = 0;
+		utf8_need = 0;
+	}
+	
+	if(c < 0x80){
+		if(c == '\r'){
+			return 1;
+		}
+		if(c == '\n'){
+			if(print_mode == PIX_PRINT_CURSOR){
+				pix->set_cursor(0);
+			}
+			return 1;
+		}
+		put_glyph(pix->glyph(c));
+	}
+	else if(c >= 0xC2 && c < 0xF5){ // Lead byte of a 2, 3 or 4 byte sequence
+		utf8[0]   = c;
+		utf8_len  = 1;
+		utf8_need = 1 + (c >= 0xE0) + (c >= 0xF0);
+	}
+	else{
+		put_glyph(pix->glyph(c)); // Latin-1, see Pixie::next_codepoint()
+	}
+	return 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Draws **size** bytes of text, see write(uint8_t)
+*/
+/**************************************************************************/
+size_t PixiePrint::write(const uint8_t* buffer, size_t size){
+	for(size_t i = 0; i < size; i++){
+		write(buffer[i]);
+	}
+	return size;
+}
+
+// Puts five PROGMEM glyph columns at the cursor, or pushes them in from the right
+void PixiePrint::put_glyph(const uint8_t* src){
+	if(print_mode == PIX_PRINT_PUSH){
+		for(uint8_t i = 0; i < 5; i++){
+			pix->push_byte(pgm_read_byte(src+i));
+		}
+		return;
+	}
+	pix->print(pgm_read_byte(src), pgm_read_byte(src+1), pgm_read_byte(src+2), pgm_read_byte(src+3), pgm_read_byte(src+4));
+}
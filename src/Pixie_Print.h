@@ -0,0 +1,41 @@
+/*!
+ * @file Pixie_Print.h
+ *
+ * Arduino Print adapter for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_print_h
+#define pixie_print_h
+#include "Pixie.h"
+
+#define PIX_PRINT_CURSOR 0 // Characters go to the cursor position and move it on, like print()
+#define PIX_PRINT_PUSH   1 // Characters are pushed in from the right, like push()
+
+/**************************************************************************/
+/*! 
+    @brief	Lets anything that takes an Arduino Print draw on a Pixie chain:
+	print(F("..."))/println(), numbers in any base, Strings and libraries
+	that print to a Print&. Each byte goes straight to its glyph, with
+	no string buffer. UTF-8 sequences are put together across calls.
+*/
+/**************************************************************************/
+class PixiePrint : public Print{
+  public:
+	PixiePrint(Pixie& display, uint8_t mode = PIX_PRINT_CURSOR);
+	size_t write(uint8_t c);
+	size_t write(const uint8_t* buffer, size_t size);
+	using Print::write;
+	void set_mode(uint8_t mode);
+	
+  private:
+	void put_glyph(const uint8_t* src);
+	
+	Pixie* pix;
+	uint8_t print_mode;
+	char    utf8[5];        // UTF-8 sequence so far, 0 terminated once complete
+	uint8_t utf8_len  = 0;
+	uint8_t utf8_need = 0;  // Continuation bytes still to come
+};
+
+#endif
@@ -0,0 +1,148 @@
+/*!
+ * @file Pixie_Scroller.cpp
+ *
+ * Non-blocking, time-based text scrolling for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Scroller.h"
+
+/**************************************************************************/
+/*!
+	Attaches a scroller to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieScroller scroller(pix);
+	</pre>
+*/
+/**************************************************************************/
+PixieScroller::PixieScroller(Pixie& display){
+	pix = &display;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Starts scrolling a message in from the right. The message is not
+	copied, so it must stay valid until done() returns true.
+	
+    @param	input		Message to scroll
+	@param	px_per_sec	Scroll speed in columns per second
+	@param	instant		Jump a whole character (5 columns) at a time, like scroll()
+*/
+/**************************************************************************/
+void PixieScroller::begin(char* input, uint16_t px_per_sec, bool instant){
+	message  = input;
+	msg_len  = pix->text_length(input);
+	msg_cols = (msg_len + pix->display_count()) * 5;
+	next_col = 0;
+	speed    = px_per_sec;
+	instant_mode = instant;
+	font     = NULL;
+	next_char = input;
+	progress = 0;
+	last_ms  = millis();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Starts scrolling a message in a proportional font, so narrow
+	glyphs take fewer columns and pass sooner. See begin() above.
+	
+    @param	input		Message to scroll
+	@param	font		Font to scroll in, such as PIX_FONT_PROP
+	@param	px_per_sec	Scroll speed in columns per second
+*/
+/**************************************************************************/
+void PixieScroller::begin(char* input, const PixieFont& font, uint16_t px_per_sec){
+	begin(input, px_per_sec, false);
+	this->font = &font;
+	msg_cols   = pix->text_width(input, font) + pix->display_count()*5;
+	glyph_width = 0;
+	glyph_step  = 0;
+	glyph_col   = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Pushes in every column that is due since the last call, then
+	calls show() once. Call this as often as possible from loop().
+	
+    @return	True if the displays were updated
+*/
+/**************************************************************************/
+bool PixieScroller::update(){
+	if(done()){
+		return false;
+	}
+	
+	uint32_t now = millis();
+	progress += (now - last_ms) * speed;
+	last_ms = now;
+	
+	uint32_t due = progress / 1000;
+	uint8_t step = 1;
+	if(instant_mode){
+		step = 5;
+	}
+	due -= due % step;
+	if(due == 0){
+		return false;
+	}
+	progress -= due * 1000;
+	
+	if(due > (uint32_t)(msg_cols - next_col)){
+		due = msg_cols - next_col;
+	}
+	for(uint16_t i = 0; i < due; i++){
+		pix->push_byte(next_column());
+		next_col++;
+	}
+	pix->show();
+	return true;
+}
+
+// Column next_col of the message, then blank once it has all been pushed
+uint8_t PixieScroller::next_column(){
+	if(font == NULL){
+		if(next_col%5 == 0){
+			glyph_src = pix->glyph(' ');
+			if(*next_char != 0){
+				glyph_src = pix->next_glyph(next_char);
+			}
+		}
+		return pgm_read_byte(glyph_src + next_col%5);
+	}
+	
+	while(glyph_col >= glyph_step && *next_char != 0){
+		char chr    = *next_char;
+		glyph_src   = pix->next_glyph(next_char, *font, &glyph_width);
+		glyph_step  = glyph_width + pix->glyph_spacing(chr, *next_char, *font);
+		glyph_col   = 0;
+	}
+	uint8_t col = 0;
+	if(glyph_col < glyph_width){
+		col = pgm_read_byte(glyph_src + glyph_col);
+	}
+	if(glyph_col < glyph_step){ // Stays at glyph_step in the blank tail
+		glyph_col++;
+	}
+	return col;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns true once the message has scrolled off the chain, or if nothing was started
+*/
+/**************************************************************************/
+bool PixieScroller::done(){
+	return next_col >= msg_cols;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Stops scrolling, leaving the displays as they are
+*/
+/**************************************************************************/
+void PixieScroller::stop(){
+	next_col = msg_cols;
+}
@@ -0,0 +1,48 @@
+/*!
+ * @file Pixie_Scroller.h
+ *
+ * Non-blocking, time-based text scrolling for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_scroller_h
+#define pixie_scroller_h
+#include "Pixie.h"
+
+/**************************************************************************/
+/*! 
+    @brief	Scrolls a message across a Pixie chain from the main loop,
+	at a fixed speed no matter how long show() takes on the chain.
+*/
+/**************************************************************************/
+class PixieScroller{
+  public:
+	PixieScroller(Pixie& display);
+	void begin(char* input, uint16_t px_per_sec = 50, bool instant = false);
+	void begin(char* input, const PixieFont& font, uint16_t px_per_sec = 50);
+	bool update();
+	bool done();
+	void stop();
+	
+  private:
+	uint8_t next_column();
+	
+	Pixie* pix;
+	char* message = NULL;
+	uint16_t msg_len  = 0;
+	uint16_t msg_cols = 0;   // Message columns plus the blank chain-width tail
+	uint16_t next_col = 0;   // Next column to push in
+	uint16_t speed = 50;     // Columns per second
+	uint32_t last_ms = 0;
+	uint32_t progress = 0;   // Elapsed ms * speed not yet spent on columns
+	bool instant_mode = false;
+	
+	const PixieFont* font = NULL; // Proportional font, or NULL for the 5 column font
+	char* next_char = NULL;  // Next message character to start
+	const uint8_t* glyph_src = NULL;
+	uint8_t glyph_width = 0;
+	uint8_t glyph_step  = 0; // Glyph columns plus spacing
+	uint8_t glyph_col   = 0;
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*!
+ * @file Pixie_Text.h
+ *
+ * Text rendered to Pixie columns at compile time, for labels stored in flash.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_text_h
+#define pixie_text_h
+#include "Pixie.h"
+#include "font_ext.h"
+
+/**************************************************************************/
+/*!
+    @brief	Renders a string literal into a PixieText at compile time, with
+	the font selected in Pixie.h. Example usage before setup():
+	<pre>
+	constexpr auto FPS_LABEL PROGMEM = PIXIE_TEXT("FPS!");
+	</pre>
+	then in loop():
+	<pre>
+	pix.write(FPS_LABEL, 2);
+	</pre>
+	The string is UTF-8 like everywhere else in the library. Characters
+	beyond ASCII come from PIX_GLYPHS_EXT (font_ext.h), whether or not the
+	sketch calls set_glyphs(), and are a space if it doesn't have them.
+*/
+/**************************************************************************/
+#define PIXIE_TEXT(str) pixie_text<PixieTextBuilder::length(str)>(str)
+
+// The constexpr steps behind PIXIE_TEXT(). Everything here is C++11: one
+// return statement per function, so loops are recursion.
+struct PixieTextBuilder{
+	// Continuation bytes after **lead**, as in Pixie::next_codepoint()
+	static constexpr uint8_t extra(uint8_t lead){
+		return (lead >= 0xC2 && lead < 0xE0) ? 1 :
+		       (lead >= 0xE0 && lead < 0xF0) ? 2 :
+		       (lead >= 0xF0 && lead < 0xF5) ? 3 : 0;
+	}
+
+	// True if the **n** bytes from **i** are all continuation bytes
+	static constexpr bool follows(const char* s, uint16_t i, uint8_t n){
+		return n == 0 || (((uint8_t)s[i] & 0xC0) == 0x80 && follows(s, i+1, n-1));
+	}
+
+	// Continuation bytes of the character at **i**, 0 if it isn't a valid sequence
+	static constexpr uint8_t tail(const char* s, uint16_t i){
+		return follows(s, i+1, extra(s[i])) ? extra(s[i]) : 0;
+	}
+
+	// Number of characters, Pixie::text_length() for a literal
+	static constexpr uint16_t length(const char* s, uint16_t i = 0){
+		return s[i] == 0 ? 0 : 1 + length(s, i + 1 + tail(s, i));
+	}
+
+	// Byte offset of character **n**
+	static constexpr uint16_t offset(const char* s, uint16_t n, uint16_t i = 0){
+		return n == 0 ? i : offset(s, n-1, i + 1 + tail(s, i));
+	}
+
+	static constexpr uint16_t decode(const char* s, uint16_t i){
+		return tail(s, i) == 1 ? (((uint8_t)s[i] & 0x1F) << 6) | ((uint8_t)s[i+1] & 0x3F) :
+		       tail(s, i) == 2 ? (((uint8_t)s[i] & 0x0F) << 12) | (((uint8_t)s[i+1] & 0x3F) << 6) | ((uint8_t)s[i+2] & 0x3F) :
+		       tail(s, i) == 3 ? 0xFFFF : (uint8_t)s[i];
+	}
+
+	// Index of **code** in PIX_GLYPHS_EXT, or -1
+	static constexpr int16_t find(uint16_t code, uint16_t lo = 0, uint16_t hi = sizeof(ext_codepoint)/2){
+		return lo >= hi ? -1 :
+		       ext_codepoint[(lo+hi)/2] == code ? (lo+hi)/2 :
+		       ext_codepoint[(lo+hi)/2] < code ? find(code, (lo+hi)/2 + 1, hi) : find(code, lo, (lo+hi)/2);
+	}
+
+	static constexpr uint8_t ext_column(int16_t index, uint8_t c){
+		return index < 0 ? col[c] : ext_col[index*5 + c]; // col[c] is the space
+	}
+
+	// Column **c** of the glyph for **code**, the same glyph as Pixie::next_glyph()
+	static constexpr uint8_t glyph_column(uint16_t code, uint8_t c){
+		return (code < 32)  ? col[code*5 + c] :
+		       (code < 128) ? col[(code-32)*5 + c] : ext_column(find(code), c);
+	}
+
+	static constexpr uint8_t column(const char* s, uint16_t x){
+		return glyph_column(decode(s, offset(s, x/5)), x%5);
+	}
+};
+
+// 0 to N-1 as a parameter pack, built in halves so long strings stay within
+// the template depth limit (std::make_index_sequence is C++14)
+template<uint16_t... I> struct PixieIndices{};
+
+template<class A, class B> struct PixieJoin;
+template<uint16_t... A, uint16_t... B>
+struct PixieJoin<PixieIndices<A...>, PixieIndices<B...> >{
+	typedef PixieIndices<A..., (uint16_t)(sizeof...(A) + B)...> type;
+};
+
+template<uint16_t N> struct PixieMakeIndices{
+	typedef typename PixieJoin<typename PixieMakeIndices<N/2>::type,
+	                           typename PixieMakeIndices<N - N/2>::type>::type type;
+};
+template<> struct PixieMakeIndices<0>{ typedef PixieIndices<> type; };
+template<> struct PixieMakeIndices<1>{ typedef PixieIndices<0> type; };
+
+template<uint16_t W, uint16_t... X>
+constexpr PixieText<W> pixie_text_columns(const char* s, PixieIndices<X...>){
+	return PixieText<W>{{PixieTextBuilder::column(s, X)...}};
+}
+
+/**************************************************************************/
+/*!
+    @brief	Renders the first **LEN** characters of **s** in the 5 column
+	font. Use PIXIE_TEXT(), which counts them.
+*/
+/**************************************************************************/
+template<uint16_t LEN>
+constexpr PixieText<LEN*5> pixie_text(const char* s){
+	static_assert(LEN > 0, "PIXIE_TEXT() needs at least one character");
+	return pixie_text_columns<LEN*5>(s, typename PixieMakeIndices<LEN*5>::type());
+}
+
+#endif
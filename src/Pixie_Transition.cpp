@@ -0,0 +1,239 @@
+/*!
+ * @file Pixie_Transition.cpp
+ *
+ * Non-blocking frame-to-frame transitions for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Transition.h"
+
+// Rows that have changed over after k of 7 dissolve steps in one column, in
+// the order 3, 0, 5, 1, 6, 2, 4. Each column rotates it by its own amount.
+static const uint8_t dissolve_rows[8] PROGMEM = {
+	0x00, 0x08, 0x09, 0x29, 0x2B, 0x6B, 0x6F, 0x7F
+};
+
+// Scrambles a column number, for the dissolve's per-column delay and rotation
+static uint8_t column_hash(uint16_t x){
+	uint8_t h = x * 157;
+	h ^= h >> 3;
+	return h * 109;
+}
+
+/**************************************************************************/
+/*!
+	Attaches a transition to a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieTransition trans(pix);
+	</pre>
+	then, to change what is shown:
+	<pre>
+	trans.capture();            // The frame on the displays
+	pix.clear();
+	pix.write("12:35");         // The next one
+	trans.begin(PIX_ROLL_UP, 300);
+	</pre>
+	and in loop(): if(trans.update()){ pix.show_changes(); }
+*/
+/**************************************************************************/
+PixieTransition::PixieTransition(Pixie& display){
+	pix = &display;
+	width = pix->display_count()*5;
+	from = new uint8_t[width];
+	to   = new uint8_t[width];
+	memset(from, 0, width);
+	memset(to, 0, width);
+}
+
+PixieTransition::~PixieTransition(){
+	delete[] from;
+	delete[] to;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Copies the visible columns of the display buffer as the frame to
+	change from. Call it before drawing the new frame.
+*/
+/**************************************************************************/
+void PixieTransition::capture(){
+	view = pix->get_view();
+	for(uint16_t x = 0; x < width; x++){
+		from[x] = pix->read_byte(at(x)) & 0x7F;
+	}
+}
+
+/**************************************************************************/
+/*!
+    @brief	Takes the visible columns of the display buffer as the frame to
+	change to, puts the captured frame back and starts the effect. Nothing
+	is sent; update() moves it on.
+
+    @param	effect	PIX_ROLL_UP, PIX_ROLL_DOWN, PIX_WIPE_RIGHT, PIX_WIPE_LEFT,
+					PIX_DISSOLVE or PIX_FLIP
+	@param	ms		Length of the transition, 0 to change at once
+	@param	changed_only	Only the display positions that differ take part,
+					the rest of the buffer is not touched until it ends.
+					PIX_FLIP always works this way.
+*/
+/**************************************************************************/
+void PixieTransition::begin(uint8_t effect, uint16_t ms, bool changed_only){
+	this->effect = effect;
+	length = ms;
+	only_changed = changed_only || effect == PIX_FLIP;
+	for(uint16_t x = 0; x < width; x++){
+		to[x] = pix->read_byte(at(x)) & 0x7F;
+	}
+	if(only_changed){ // Marks the positions with a new character
+		for(uint16_t p = 0; p < width; p += 5){
+			if(memcmp(from + p, to + p, 5) != 0){
+				for(uint8_t c = 0; c < 5; c++){
+					from[p + c] |= 0x80;
+				}
+			}
+		}
+	}
+	start = millis();
+	running = length > 0;
+	draw(0); // The old frame back, marking what the transition will change
+	if(!running){
+		draw(steps());
+	}
+}
+
+// Canvas column shown at visible column **x**, past the end of a PIX_WRAP
+// canvas back at its start, like Pixie::encode()
+uint16_t PixieTransition::at(uint16_t x){
+	uint16_t c = view + x;
+	uint16_t w = pix->canvas_width();
+	if(c >= w){
+		c -= w;
+	}
+	return c;
+}
+
+// Number of steps from the old frame (step 0) to the new one
+uint16_t PixieTransition::steps(){
+	if(effect == PIX_WIPE_RIGHT || effect == PIX_WIPE_LEFT){
+		return width;
+	}
+	if(effect == PIX_DISSOLVE){
+		return 7 + 8; // 7 rows, after a delay of up to 7 steps
+	}
+	return 7;
+}
+
+// Column **x** at **step**
+uint8_t PixieTransition::column(uint16_t x, uint16_t step){
+	uint8_t a = from[x] & 0x7F;
+	uint8_t b = to[x];
+	switch(effect){
+		case PIX_ROLL_UP: // Bit 0 is the top row: up is a right shift
+			return ((a >> step) | (b << (7 - step))) & 0x7F;
+		case PIX_ROLL_DOWN:
+			return ((a << step) | (b >> (7 - step))) & 0x7F;
+		case PIX_WIPE_RIGHT:
+			return x < step ? b : a;
+		case PIX_WIPE_LEFT:
+			return x >= width - step ? b : a;
+		case PIX_DISSOLVE:{
+			uint8_t h = column_hash(x);
+			int16_t k = (int16_t)step - (h & 7); // Each column starts after its own delay
+			if(k <= 0){
+				return a;
+			}
+			if(k > 7){
+				k = 7;
+			}
+			uint8_t rows = pgm_read_byte(dissolve_rows + k);
+			uint8_t r = (h >> 3) % 7;
+			rows = ((rows << r) | (rows >> (7 - r))) & 0x7F;
+			return (a & ~rows) | (b & rows);
+		}
+		case PIX_FLIP:{
+			uint8_t rows = (1 << step) - 1; // Top rows already flipped
+			uint8_t col = (b & rows) | (a & ~rows & 0x7F);
+			if(step > 0 && step < 7){
+				col |= 1 << step; // Edge of the falling flap
+			}
+			return col;
+		}
+	}
+	return b;
+}
+
+// Writes **step** to the display buffer, marking the columns that changed
+void PixieTransition::draw(uint16_t step){
+	int16_t first = -1;
+	int16_t last  = -1;
+	for(uint16_t x = 0; x < width; x++){
+		if(only_changed && !(from[x] & 0x80)){
+			continue;
+		}
+		uint8_t col = column(x, step);
+		if(col != pix->read_byte(at(x))){
+			pix->write_byte(col, at(x));
+			if(first < 0){
+				first = x;
+			}
+			last = x;
+		}
+	}
+	if(first >= 0){
+		pix->mark_dirty(at(first), last - first + 1); // A canvas marks the whole chain anyway
+	}
+	this->step = step;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves the effect on to the step that is due by now. Nothing is
+	sent, follow it with show_changes() (or show()). Call this as often as
+	possible from loop().
+
+    @return	True if the display buffer changed
+*/
+/**************************************************************************/
+bool PixieTransition::update(){
+	if(!running){
+		return false;
+	}
+	uint32_t elapsed = millis() - start;
+	uint16_t n = steps();
+	uint16_t s = n;
+	if(elapsed < length){
+		s = elapsed * n / length;
+	}
+	if(s >= n){
+		running = false;
+		s = n;
+	}
+	if(s == step){
+		return false;
+	}
+	draw(s);
+	return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns true once the new frame is fully in the display buffer,
+	or if nothing was started
+*/
+/**************************************************************************/
+bool PixieTransition::done(){
+	return !running;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Ends the transition at once on the new frame
+*/
+/**************************************************************************/
+void PixieTransition::stop(){
+	if(running){
+		draw(steps());
+		running = false;
+	}
+}
@@ -0,0 +1,58 @@
+/*!
+ * @file Pixie_Transition.h
+ *
+ * Non-blocking frame-to-frame transitions for Pixie displays.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_transition_h
+#define pixie_transition_h
+#include "Pixie.h"
+
+#define PIX_ROLL_UP    0 // The new frame rolls in from below, pushing the old one out the top
+#define PIX_ROLL_DOWN  1 // The new frame rolls in from above
+#define PIX_WIPE_RIGHT 2 // The new frame is uncovered from the left edge to the right
+#define PIX_WIPE_LEFT  3 // The new frame is uncovered from the right edge to the left
+#define PIX_DISSOLVE   4 // Pixels change over in a scattered order
+#define PIX_FLIP       5 // Each position that changes flips over top to bottom, like a split-flap clock
+
+/**************************************************************************/
+/*!
+    @brief	Changes a Pixie chain from one frame to the next with an effect,
+	from the main loop. Every step is computed from the two frames with
+	whole-column bit operations (shifts and masks), so a step costs the
+	same for any content, linear in the number of visible columns. Only
+	the columns that differ from the last step are written and marked
+	for Pixie::show_changes().
+*/
+/**************************************************************************/
+class PixieTransition{
+  public:
+	PixieTransition(Pixie& display);
+	~PixieTransition();
+	void capture();
+	void begin(uint8_t effect, uint16_t ms, bool changed_only = false);
+	bool update();
+	bool done();
+	void stop();
+
+  private:
+	uint16_t steps();
+	uint8_t column(uint16_t x, uint16_t step);
+	void draw(uint16_t step);
+	uint16_t at(uint16_t x);
+
+	Pixie* pix;
+	uint8_t* from;           // Old frame; bit 7 marks the positions that change, see only_changed
+	uint8_t* to;             // New frame
+	uint16_t width;
+	uint16_t view    = 0;    // Canvas column of the first visible column
+	uint8_t  effect  = PIX_ROLL_UP;
+	uint16_t length  = 0;    // ms
+	uint32_t start   = 0;    // millis() when it began
+	uint16_t step    = 0;    // Step on the displays
+	bool     running = false;
+	bool     only_changed = false; // Positions whose columns are all the same are left alone
+};
+
+#endif
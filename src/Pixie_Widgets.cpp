@@ -0,0 +1,209 @@
+/*!
+ * @file Pixie_Widgets.cpp
+ *
+ * Counter and clock fields that redraw only the digits that changed.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#include "Pixie_Widgets.h"
+
+// Creates a field of **width** positions from display position **pos**,
+// showing nothing it knows of, so the first text is drawn whole
+PixieDigits::PixieDigits(Pixie& display, uint8_t pos, uint8_t width){
+	pix = &display;
+	at_pos = pos;
+	count  = width;
+	shown  = new char[count];
+	invalidate();
+}
+
+PixieDigits::~PixieDigits(){
+	delete[] shown;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Changes the digits that differ with **effect** (see
+	PixieTransition::begin()) over **ms** instead of at once. Only the
+	changed positions take part. While it runs, update() moves it on; the
+	rest of the chain can be drawn on as usual. A transition is meant for
+	one field: setting another field it drives ends the first one's effect.
+*/
+/**************************************************************************/
+void PixieDigits::animate(PixieTransition& trans, uint8_t effect, uint16_t ms){
+	this->trans  = &trans;
+	this->effect = effect;
+	length = ms;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Forgets what the field shows, so the next value is drawn whole.
+	Call it after clear() or anything else drawn over the field.
+*/
+/**************************************************************************/
+void PixieDigits::invalidate(){
+	memset(shown, 0, count);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Moves the digit effect from animate() on. Nothing is sent,
+	follow it with show_changes().
+
+    @return	True if the display buffer changed
+*/
+/**************************************************************************/
+bool PixieDigits::update(){
+	if(trans == NULL){
+		return false;
+	}
+	return trans->update();
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns true once the field shows its last value in full
+*/
+/**************************************************************************/
+bool PixieDigits::done(){
+	return trans == NULL || trans->done();
+}
+
+// Draws the characters of **text** (**count** of them) that differ from the
+// ones shown, and returns how many positions were drawn
+uint8_t PixieDigits::show_text(const char* text){
+	uint8_t changed = 0;
+	for(uint8_t i = 0; i < count; i++){
+		changed += text[i] != shown[i];
+	}
+	if(changed == 0){
+		return 0;
+	}
+	bool effect_on = trans != NULL && length > 0;
+	if(effect_on){
+		trans->stop();
+		trans->capture();
+	}
+	for(uint8_t i = 0; i < count; i++){
+		if(text[i] == shown[i]){
+			continue;
+		}
+		shown[i] = text[i];
+		int16_t x = (at_pos + i) * 5;
+		pix->draw_P(pix->glyph(text[i]), 5, x);
+		pix->mark_dirty(x, 5);
+	}
+	if(effect_on){
+		trans->begin(effect, length, true);
+	}
+	return changed;
+}
+
+/**************************************************************************/
+/*!
+	Creates a counter on a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieCounter visitors(pix, 6, 6);     // Positions 6-11
+	</pre>
+	then in loop(): visitors.set(n); pix.show_changes();
+
+    @param	display	Chain it is drawn on
+	@param	pos		Display position of the leftmost digit
+	@param	digits	Positions of the field, the sign included, at most 11
+	@param	pad		' ' or '0' before a shorter number
+*/
+/**************************************************************************/
+PixieCounter::PixieCounter(Pixie& display, uint8_t pos, uint8_t digits, char pad)
+	: PixieDigits(display, pos, digits > 11 ? 11 : digits){
+	this->pad = pad;
+}
+
+/**************************************************************************/
+/*!
+    @brief	Shows **value**, drawing only the digits that changed
+
+    @return	Number of positions drawn
+*/
+/**************************************************************************/
+uint8_t PixieCounter::set(int32_t value){
+	this->value = value;
+	bool negative = value < 0;
+	uint32_t n = negative ? 0 - (uint32_t)value : value;
+	char digits[12];               // Least significant first
+	uint8_t len = Pixie::decimal_digits(n, digits);
+	char text[11];                 // "-2147483648"
+	int16_t i = count - 1;
+	for(uint8_t d = 0; d < len && i >= 0; d++){
+		text[i--] = digits[d];
+	}
+	int16_t sign = i;              // Right before the digits
+	if(pad == '0'){
+		sign = 0;                  // At the left edge, before the zeros
+	}
+	for(; i >= 0; i--){
+		text[i] = pad;
+	}
+	if(negative && sign >= 0 && text[sign] == pad){
+		text[sign] = '-';
+	}
+	return show_text(text);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Returns the last value given to set()
+*/
+/**************************************************************************/
+int32_t PixieCounter::get(){
+	return value;
+}
+
+/**************************************************************************/
+/*!
+	Creates a clock on a Pixie chain. Example usage before setup() would be:
+	<pre>
+	Pixie pix(NUM_PIXIES, CLK_PIN, DATA_PIN);
+	PixieClock clock(pix, 2);             // "HH:MM:SS" on positions 2-9
+	</pre>
+	then clock.set(h, m, s); pix.show_changes(); whenever the time changes.
+
+    @param	display	Chain it is drawn on
+	@param	pos		Display position of the first hour digit
+	@param	seconds	false for HH:MM
+*/
+/**************************************************************************/
+PixieClock::PixieClock(Pixie& display, uint8_t pos, bool seconds)
+	: PixieDigits(display, pos, seconds ? 8 : 5){
+}
+
+/**************************************************************************/
+/*!
+    @brief	Shows **hours**:**minutes**(:**seconds**), drawing only the
+	digits that changed. Once a second that is usually one position, and
+	the colons are never drawn again.
+
+    @return	Number of positions drawn
+*/
+/**************************************************************************/
+uint8_t PixieClock::set(uint8_t hours, uint8_t minutes, uint8_t seconds){
+	char text[8] = {
+		(char)('0' + hours / 10 % 10),   (char)('0' + hours % 10),   ':',
+		(char)('0' + minutes / 10 % 10), (char)('0' + minutes % 10), ':',
+		(char)('0' + seconds / 10 % 10), (char)('0' + seconds % 10)
+	};
+	return show_text(text);
+}
+
+/**************************************************************************/
+/*!
+    @brief	Shows the time of day **seconds** after midnight, as from an
+	NTP client or RTC
+
+    @return	Number of positions drawn
+*/
+/**************************************************************************/
+uint8_t PixieClock::set(uint32_t seconds){
+	return set(seconds / 3600 % 24, seconds / 60 % 60, seconds % 60);
+}
@@ -0,0 +1,74 @@
+/*!
+ * @file Pixie_Widgets.h
+ *
+ * Counter and clock fields that redraw only the digits that changed.
+ * Released under the GPLv3 license, all text here must be included in any redistribution.
+ */
+
+#ifndef pixie_widgets_h
+#define pixie_widgets_h
+#include "Pixie.h"
+#include "Pixie_Transition.h"
+
+/**************************************************************************/
+/*!
+    @brief	A field of display positions on a Pixie chain that remembers the
+	characters it shows. New text is compared with them and only the
+	positions that differ are drawn and marked for Pixie::show_changes(),
+	so a value that changes in its last digit costs one glyph and one
+	module. The base of PixieCounter and PixieClock.
+*/
+/**************************************************************************/
+class PixieDigits{
+  public:
+	~PixieDigits();
+	void animate(PixieTransition& trans, uint8_t effect = PIX_ROLL_UP, uint16_t ms = 200);
+	void invalidate();
+	bool update();
+	bool done();
+
+  protected:
+	PixieDigits(Pixie& display, uint8_t pos, uint8_t width);
+	uint8_t show_text(const char* text);
+
+	Pixie* pix;
+	char*   shown;           // Characters on the positions, 0 where unknown
+	uint8_t at_pos;          // First display position of the field
+	uint8_t count;           // Positions in the field
+	PixieTransition* trans = NULL; // Per-digit effect, see animate()
+	uint8_t effect = PIX_ROLL_UP;
+	uint16_t length = 0;     // ms
+};
+
+/**************************************************************************/
+/*!
+    @brief	A number right-aligned in **digits** positions (up to 11, any
+	int32_t), padded with spaces or zeros. Only its last **digits**
+	characters are shown if it is longer, like an odometer.
+*/
+/**************************************************************************/
+class PixieCounter : public PixieDigits{
+  public:
+	PixieCounter(Pixie& display, uint8_t pos, uint8_t digits, char pad = ' ');
+	uint8_t set(int32_t value);
+	int32_t get();
+
+  private:
+	int32_t value = 0;
+	char    pad;
+};
+
+/**************************************************************************/
+/*!
+    @brief	A clock as HH:MM:SS, or HH:MM without seconds, in 8 or 5
+	display positions
+*/
+/**************************************************************************/
+class PixieClock : public PixieDigits{
+  public:
+	PixieClock(Pixie& display, uint8_t pos, bool seconds = true);
+	uint8_t set(uint8_t hours, uint8_t minutes, uint8_t seconds = 0);
+	uint8_t set(uint32_t seconds);
+};
+
+#endif
@@ -0,0 +1,34 @@
+// Generated by extras/pack_assets.py from font.h, do not edit.
+// 96 glyphs, 5 columns each, 7 bits per column: 420 bytes of flash instead of 480.
+
+const uint8_t pix_font_7bit_data[420] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x28, 0x7F, 0xCA,
+	0x9F, 0x42, 0x52, 0xFD, 0x55, 0x92, 0xD1, 0x04, 0x41, 0x16, 0xDB, 0x92, 0x55, 0x11, 0x14, 0x50,
+	0x18, 0x00, 0x00, 0x00, 0x8E, 0x28, 0x08, 0x00, 0x04, 0x45, 0x1C, 0x00, 0x42, 0xC5, 0x51, 0x21,
+	0x10, 0x08, 0x1F, 0x02, 0x01, 0x80, 0xC2, 0x00, 0x00, 0x04, 0x02, 0x81, 0x40, 0x00, 0xC0, 0x60,
+	0x00, 0x00, 0x04, 0x41, 0x10, 0x04, 0xBE, 0x68, 0xB2, 0xE8, 0x03, 0x08, 0xFF, 0x40, 0x80, 0x30,
+	0x1C, 0x4D, 0x1A, 0x43, 0xC1, 0xE2, 0x32, 0x86, 0xA1, 0x48, 0xFE, 0x90, 0x53, 0xB1, 0x58, 0xCC,
+	0xF1, 0x94, 0xC9, 0x24, 0x2C, 0x10, 0x4F, 0x14, 0x06, 0xB6, 0x64, 0x32, 0x69, 0x33, 0x24, 0x93,
+	0x29, 0x0F, 0xC0, 0x66, 0x03, 0x00, 0x00, 0x56, 0x1B, 0x00, 0x00, 0x40, 0x50, 0x44, 0x41, 0x0A,
+	0x85, 0x42, 0xA1, 0x04, 0x45, 0x14, 0x04, 0x40, 0x10, 0x88, 0x26, 0x0C, 0xB2, 0x64, 0x3E, 0xE8,
+	0xF3, 0x47, 0x22, 0x11, 0xFF, 0x3F, 0x99, 0x4C, 0xDA, 0x7C, 0xC1, 0x60, 0x50, 0xF4, 0x0F, 0x06,
+	0x45, 0x9C, 0x7F, 0x32, 0x99, 0x0C, 0xFE, 0x13, 0x89, 0x40, 0xC0, 0x17, 0x0C, 0x46, 0x65, 0x7F,
+	0x04, 0x02, 0xF1, 0x07, 0x04, 0xFF, 0x41, 0x00, 0x08, 0x18, 0xFC, 0x05, 0xFE, 0x08, 0x8A, 0x28,
+	0xF8, 0x07, 0x02, 0x81, 0xC0, 0xBF, 0x80, 0x20, 0xF8, 0xFF, 0x09, 0x08, 0xC8, 0xDF, 0x17, 0x0C,
+	0x06, 0x7D, 0xFF, 0x44, 0x22, 0x61, 0xF0, 0x05, 0xA3, 0x21, 0xEF, 0x3F, 0x91, 0x49, 0x19, 0x8D,
+	0xC9, 0x64, 0x32, 0x16, 0x08, 0xFC, 0x03, 0x81, 0x1F, 0x10, 0x08, 0xFC, 0x7D, 0x40, 0x40, 0xD0,
+	0xE7, 0x0F, 0xC2, 0x80, 0xFE, 0x63, 0x0A, 0x82, 0x32, 0x1E, 0x10, 0xF0, 0x84, 0x41, 0x38, 0x9A,
+	0x2C, 0x0E, 0x01, 0x80, 0x7F, 0x30, 0x28, 0x20, 0x20, 0x20, 0xA0, 0x60, 0xF0, 0x0F, 0x00, 0x10,
+	0x04, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x81, 0x80, 0x80, 0x80, 0x00, 0x00, 0x51, 0xA9, 0x54,
+	0xFC, 0x1F, 0x49, 0x24, 0xE2, 0x70, 0x44, 0x22, 0x11, 0x84, 0x23, 0x12, 0x91, 0x7F, 0x1C, 0x95,
+	0x4A, 0xC5, 0x20, 0xFC, 0x89, 0x80, 0x00, 0x41, 0xA1, 0x52, 0x79, 0x7F, 0x04, 0x81, 0x80, 0x07,
+	0x10, 0xFB, 0x40, 0x00, 0x08, 0x48, 0xEC, 0x01, 0x00, 0x7F, 0x08, 0x8A, 0x08, 0x08, 0xFE, 0x81,
+	0x00, 0x3E, 0x01, 0x43, 0xC0, 0xF3, 0x11, 0x04, 0x02, 0x1E, 0x47, 0x24, 0x12, 0x71, 0x7C, 0x0A,
+	0x85, 0x82, 0x40, 0x50, 0x28, 0x18, 0x3E, 0x1F, 0x41, 0x20, 0x20, 0x90, 0x54, 0x2A, 0x15, 0x44,
+	0xF8, 0x11, 0x81, 0x20, 0x1E, 0x10, 0x08, 0xE2, 0x73, 0x40, 0x40, 0x10, 0x87, 0x07, 0x84, 0x01,
+	0x79, 0x44, 0x14, 0x04, 0x45, 0x64, 0x40, 0xA1, 0x50, 0x1E, 0x91, 0x4C, 0x65, 0x12, 0x01, 0x08,
+	0x5B, 0x10, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x40, 0xD0, 0x86, 0x00, 0x20, 0x10, 0x2A, 0x0E, 0x02,
+	0x00, 0x00, 0x00, 0x00,
+};
+
+const PixieAssets PIX_FONT_7BIT = {pix_font_7bit_data, NULL, 96, 5, PIX_PACK7};
@@ -1,4 +1,4 @@
-const uint8_t col[480] PROGMEM = {
+constexpr uint8_t col[480] PROGMEM = {
 	0x00, 0x00, 0x00, 0x00, 0x00,  // SPACE 
 	0x00, 0x00, 0x5F, 0x00, 0x00,  // !
 	0x00, 0x03, 0x00, 0x03, 0x00,  // "
@@ -0,0 +1,251 @@
+// Extended glyph set for UTF-8 text: Latin-1, the Latin Extended-A letters of
+// Pixie_Icon_Pack.h, Greek, dashes and quotes, arrows, box drawing and block
+// elements. Include it in the sketch and pass PIX_GLYPHS_EXT to set_glyphs().
+// Code points must stay sorted, they are found by binary search.
+
+#ifndef pixie_font_ext_h
+#define pixie_font_ext_h
+
+constexpr uint16_t ext_codepoint[208] PROGMEM = {
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+	0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+	0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+	0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+	0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+	0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+	0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+	0x0101, 0x0105, 0x0107, 0x010D, 0x0113, 0x0119, 0x012B, 0x013C,
+	0x0142, 0x0144, 0x0146, 0x014D, 0x015B, 0x0161, 0x016B, 0x017A,
+	0x017C, 0x017E, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396,
+	0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E,
+	0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+	0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6,
+	0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE,
+	0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
+	0x03C7, 0x03C8, 0x03C9, 0x2013, 0x2014, 0x2018, 0x2019, 0x201C,
+	0x201D, 0x2022, 0x2026, 0x20AC, 0x2190, 0x2191, 0x2192, 0x2193,
+	0x2194, 0x2195, 0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518,
+	0x251C, 0x2524, 0x252C, 0x2534, 0x253C, 0x2550, 0x2551, 0x2554,
+	0x2557, 0x255A, 0x255D, 0x2560, 0x2563, 0x2566, 0x2569, 0x256C,
+	0x2580, 0x2584, 0x2588, 0x258C, 0x2590, 0x2591, 0x2592, 0x2593,
+};
+
+constexpr uint8_t ext_col[1040] PROGMEM = {
+	  0x00, 0x00, 0x00, 0x00, 0x00, // U+00A0 no-break space
+	  0x00, 0x00, 0x7D, 0x00, 0x00, // U+00A1 inverted !
+	  0x1C, 0x22, 0x63, 0x22, 0x14, // U+00A2 cent
+	  0x48, 0x3E, 0x49, 0x49, 0x42, // U+00A3 pound
+	  0x22, 0x1C, 0x14, 0x1C, 0x22, // U+00A4 currency
+	  0x01, 0x0A, 0x7C, 0x0A, 0x01, // U+00A5 yen
+	  0x00, 0x00, 0x77, 0x00, 0x00, // U+00A6 broken bar
+	  0x4A, 0x55, 0x55, 0x55, 0x29, // U+00A7 section
+	  0x00, 0x02, 0x00, 0x02, 0x00, // U+00A8 diaeresis
+	  0x0E, 0x11, 0x11, 0x0A, 0x00, // U+00A9 copyright
+	  0x48, 0x55, 0x55, 0x55, 0x5E, // U+00AA feminine ordinal
+	  0x08, 0x14, 0x22, 0x08, 0x14, // U+00AB left guillemet
+	  0x04, 0x04, 0x04, 0x04, 0x1C, // U+00AC not
+	  0x08, 0x08, 0x08, 0x08, 0x08, // U+00AD soft hyphen
+	  0x1F, 0x05, 0x0D, 0x12, 0x00, // U+00AE registered
+	  0x01, 0x01, 0x01, 0x01, 0x01, // U+00AF macron
+	  0x02, 0x05, 0x02, 0x00, 0x00, // U+00B0 degree
+	  0x44, 0x44, 0x5F, 0x44, 0x44, // U+00B1 plus-minus
+	  0x19, 0x15, 0x12, 0x00, 0x00, // U+00B2 superscript 2
+	  0x11, 0x15, 0x1F, 0x00, 0x00, // U+00B3 superscript 3
+	  0x00, 0x00, 0x02, 0x01, 0x00, // U+00B4 acute
+	  0x00, 0x7C, 0x20, 0x20, 0x1C, // U+00B5 micro
+	  0x06, 0x0F, 0x7F, 0x01, 0x7F, // U+00B6 pilcrow
+	  0x00, 0x00, 0x08, 0x00, 0x00, // U+00B7 middle dot
+	  0x00, 0x40, 0x60, 0x00, 0x00, // U+00B8 cedilla
+	  0x12, 0x1F, 0x10, 0x00, 0x00, // U+00B9 superscript 1
+	  0x4E, 0x51, 0x51, 0x51, 0x4E, // U+00BA masculine ordinal
+	  0x14, 0x08, 0x22, 0x14, 0x08, // U+00BB right guillemet
+	  0x27, 0x10, 0x28, 0x74, 0x22, // U+00BC one quarter
+	  0x27, 0x10, 0x48, 0x54, 0x32, // U+00BD one half
+	  0x25, 0x17, 0x28, 0x74, 0x22, // U+00BE three quarters
+	  0x30, 0x48, 0x45, 0x40, 0x20, // U+00BF inverted ?
+	  0x7C, 0x13, 0x12, 0x12, 0x7C, // U+00C0 A grave
+	  0x7C, 0x12, 0x12, 0x13, 0x7C, // U+00C1 A acute
+	  0x7C, 0x12, 0x13, 0x12, 0x7C, // U+00C2 A circ
+	  0x7A, 0x15, 0x15, 0x16, 0x79, // U+00C3 A tilde
+	  0x7C, 0x13, 0x12, 0x13, 0x7C, // U+00C4 A diaeresis
+	  0x70, 0x2A, 0x25, 0x2A, 0x70, // U+00C5 A ring
+	  0x7E, 0x09, 0x7F, 0x49, 0x49, // U+00C6 AE
+	  0x1E, 0x21, 0x61, 0x61, 0x12, // U+00C7 C cedilla
+	  0x7E, 0x4B, 0x4A, 0x4A, 0x42, // U+00C8 E grave
+	  0x7E, 0x4A, 0x4A, 0x4B, 0x42, // U+00C9 E acute
+	  0x7E, 0x4A, 0x4B, 0x4A, 0x42, // U+00CA E circ
+	  0x7E, 0x4B, 0x4A, 0x4B, 0x42, // U+00CB E uml
+	  0x00, 0x43, 0x7E, 0x42, 0x00, // U+00CC I grave
+	  0x00, 0x42, 0x7E, 0x43, 0x00, // U+00CD I acute
+	  0x00, 0x42, 0x7F, 0x42, 0x00, // U+00CE I circ
+	  0x00, 0x43, 0x7E, 0x43, 0x00, // U+00CF I uml
+	  0x49, 0x7F, 0x49, 0x41, 0x3E, // U+00D0 ETH
+	  0x7E, 0x09, 0x11, 0x22, 0x7D, // U+00D1 N tilde
+	  0x3C, 0x43, 0x42, 0x42, 0x3C, // U+00D2 O grave
+	  0x3C, 0x42, 0x42, 0x43, 0x3C, // U+00D3 O acute
+	  0x3C, 0x42, 0x43, 0x42, 0x3C, // U+00D4 O circ
+	  0x3A, 0x45, 0x45, 0x46, 0x39, // U+00D5 O tilde
+	  0x3C, 0x43, 0x42, 0x43, 0x3C, // U+00D6 O diaeresis
+	  0x22, 0x14, 0x08, 0x14, 0x22, // U+00D7 multiply
+	  0x3E, 0x61, 0x5D, 0x43, 0x3E, // U+00D8 O stroke
+	  0x3E, 0x41, 0x40, 0x40, 0x3E, // U+00D9 U grave
+	  0x3E, 0x40, 0x40, 0x41, 0x3E, // U+00DA U acute
+	  0x3E, 0x40, 0x41, 0x40, 0x3E, // U+00DB U circ
+	  0x3E, 0x41, 0x40, 0x41, 0x3E, // U+00DC U uml
+	  0x06, 0x08, 0x70, 0x09, 0x06, // U+00DD Y acute
+	  0x7F, 0x12, 0x12, 0x12, 0x0C, // U+00DE THORN
+	  0x7E, 0x01, 0x45, 0x4A, 0x30, // U+00DF sharp s
+	  0x20, 0x54, 0x55, 0x56, 0x78, // U+00E0 a grave
+	  0x20, 0x54, 0x56, 0x55, 0x78, // U+00E1 a acute
+	  0x20, 0x56, 0x55, 0x56, 0x78, // U+00E2 a circumflex
+	  0x22, 0x55, 0x56, 0x55, 0x78, // U+00E3 a tilde
+	  0x20, 0x55, 0x54, 0x55, 0x78, // U+00E4 a umlaut
+	  0x20, 0x54, 0x55, 0x54, 0x78, // U+00E5 a overdot
+	  0x24, 0x54, 0x38, 0x54, 0x58, // U+00E6 ae
+	  0x0C, 0x52, 0x32, 0x12, 0x00, // U+00E7 c cedilla
+	  0x38, 0x54, 0x55, 0x56, 0x18, // U+00E8 e grave
+	  0x38, 0x56, 0x55, 0x54, 0x18, // U+00E9 e acute
+	  0x38, 0x56, 0x55, 0x56, 0x18, // U+00EA e circumflex
+	  0x38, 0x55, 0x54, 0x55, 0x18, // U+00EB e umlaut
+	  0x00, 0x01, 0x7A, 0x00, 0x00, // U+00EC i grave
+	  0x00, 0x00, 0x7A, 0x01, 0x00, // U+00ED i acute
+	  0x00, 0x02, 0x79, 0x02, 0x00, // U+00EE i circumflex
+	  0x00, 0x02, 0x78, 0x02, 0x00, // U+00EF i umlaut
+	  0x00, 0x35, 0x4A, 0x4D, 0x38, // U+00F0 eth
+	  0x7A, 0x11, 0x0A, 0x09, 0x70, // U+00F1 n tilde
+	  0x38, 0x45, 0x46, 0x44, 0x38, // U+00F2 o grave
+	  0x38, 0x44, 0x46, 0x45, 0x38, // U+00F3 o acute
+	  0x38, 0x46, 0x45, 0x46, 0x38, // U+00F4 o circumflex
+	  0x3A, 0x45, 0x46, 0x45, 0x38, // U+00F5 o tilde
+	  0x38, 0x45, 0x44, 0x45, 0x38, // U+00F6 o umlaut
+	  0x08, 0x08, 0x2A, 0x08, 0x08, // U+00F7 divide
+	  0x38, 0x64, 0x54, 0x4C, 0x38, // U+00F8 o stroke
+	  0x3C, 0x41, 0x42, 0x20, 0x7C, // U+00F9 u grave
+	  0x3C, 0x40, 0x42, 0x21, 0x7C, // U+00FA u acute
+	  0x38, 0x42, 0x41, 0x22, 0x78, // U+00FB u circumflex
+	  0x3C, 0x41, 0x40, 0x21, 0x7C, // U+00FC u umlaut
+	  0x0C, 0x50, 0x52, 0x51, 0x3C, // U+00FD y acute
+	  0x7F, 0x12, 0x12, 0x12, 0x0C, // U+00FE thorn
+	  0x0C, 0x51, 0x50, 0x51, 0x3C, // U+00FF y diaeresis
+	  0x20, 0x55, 0x55, 0x55, 0x78, // U+0101 a macron
+	  0x08, 0x55, 0x35, 0x15, 0x1E, // U+0105 a ogonek
+	  0x30, 0x4A, 0x49, 0x48, 0x00, // U+0107 c acute
+	  0x30, 0x49, 0x4A, 0x49, 0x00, // U+010D c caron
+	  0x38, 0x55, 0x55, 0x55, 0x18, // U+0113 e macron
+	  0x0E, 0x55, 0x35, 0x15, 0x06, // U+0119 e ogonek
+	  0x00, 0x02, 0x7A, 0x02, 0x00, // U+012B i macron
+	  0x00, 0x40, 0x3F, 0x00, 0x00, // U+013C l cedilla
+	  0x20, 0x10, 0x7F, 0x04, 0x02, // U+0142 l stroke
+	  0x7C, 0x08, 0x06, 0x05, 0x78, // U+0144 n acute
+	  0x1F, 0x42, 0x21, 0x01, 0x1E, // U+0146 n cedilla
+	  0x38, 0x45, 0x45, 0x45, 0x38, // U+014D o macron
+	  0x48, 0x54, 0x56, 0x55, 0x24, // U+015B s acute
+	  0x48, 0x55, 0x56, 0x55, 0x24, // U+0161 s caron
+	  0x3C, 0x41, 0x41, 0x21, 0x7C, // U+016B u macron
+	  0x44, 0x64, 0x56, 0x4D, 0x44, // U+017A z acute
+	  0x44, 0x64, 0x55, 0x4C, 0x44, // U+017C z overdot
+	  0x44, 0x65, 0x56, 0x4D, 0x44, // U+017E z caron
+	  0x7E, 0x11, 0x11, 0x11, 0x7E, // U+0391 Alpha (as A)
+	  0x7F, 0x49, 0x49, 0x49, 0x36, // U+0392 Beta (as B)
+	  0x7F, 0x01, 0x01, 0x01, 0x01, // U+0393 Gamma
+	  0x70, 0x4C, 0x43, 0x4C, 0x70, // U+0394 Delta
+	  0x7F, 0x49, 0x49, 0x49, 0x41, // U+0395 Epsilon (as E)
+	  0x61, 0x51, 0x49, 0x45, 0x43, // U+0396 Zeta (as Z)
+	  0x7F, 0x08, 0x08, 0x08, 0x7F, // U+0397 Eta (as H)
+	  0x3E, 0x49, 0x49, 0x49, 0x3E, // U+0398 Theta
+	  0x00, 0x41, 0x7F, 0x41, 0x00, // U+0399 Iota (as I)
+	  0x7F, 0x08, 0x14, 0x22, 0x41, // U+039A Kappa (as K)
+	  0x70, 0x0C, 0x03, 0x0C, 0x70, // U+039B Lambda
+	  0x7F, 0x02, 0x04, 0x02, 0x7F, // U+039C Mu (as M)
+	  0x7F, 0x04, 0x08, 0x10, 0x7F, // U+039D Nu (as N)
+	  0x41, 0x49, 0x49, 0x49, 0x41, // U+039E Xi
+	  0x3E, 0x41, 0x41, 0x41, 0x3E, // U+039F Omicron (as O)
+	  0x7F, 0x01, 0x01, 0x01, 0x7F, // U+03A0 Pi
+	  0x7F, 0x09, 0x09, 0x09, 0x06, // U+03A1 Rho (as P)
+	  0x63, 0x55, 0x49, 0x41, 0x41, // U+03A3 Sigma
+	  0x01, 0x01, 0x7F, 0x01, 0x01, // U+03A4 Tau (as T)
+	  0x03, 0x04, 0x78, 0x04, 0x03, // U+03A5 Upsilon (as Y)
+	  0x1C, 0x22, 0x7F, 0x22, 0x1C, // U+03A6 Phi
+	  0x63, 0x14, 0x08, 0x14, 0x63, // U+03A7 Chi (as X)
+	  0x07, 0x08, 0x7F, 0x08, 0x07, // U+03A8 Psi
+	  0x4E, 0x71, 0x01, 0x71, 0x4E, // U+03A9 Omega
+	  0x38, 0x44, 0x44, 0x38, 0x44, // U+03B1 alpha
+	  0x7E, 0x25, 0x25, 0x1A, 0x00, // U+03B2 beta
+	  0x04, 0x28, 0x50, 0x28, 0x04, // U+03B3 gamma
+	  0x3A, 0x45, 0x45, 0x49, 0x30, // U+03B4 delta
+	  0x28, 0x54, 0x54, 0x44, 0x00, // U+03B5 epsilon
+	  0x11, 0x29, 0x25, 0x23, 0x41, // U+03B6 zeta
+	  0x3C, 0x08, 0x04, 0x04, 0x78, // U+03B7 eta
+	  0x3E, 0x49, 0x49, 0x3E, 0x00, // U+03B8 theta
+	  0x00, 0x3C, 0x40, 0x40, 0x20, // U+03B9 iota
+	  0x7C, 0x10, 0x28, 0x44, 0x00, // U+03BA kappa
+	  0x61, 0x16, 0x08, 0x10, 0x60, // U+03BB lambda
+	  0x00, 0x7C, 0x20, 0x20, 0x1C, // U+03BC mu
+	  0x1C, 0x20, 0x40, 0x20, 0x1C, // U+03BD nu
+	  0x11, 0x2B, 0x25, 0x25, 0x41, // U+03BE xi
+	  0x38, 0x44, 0x44, 0x44, 0x38, // U+03BF omicron
+	  0x04, 0x7C, 0x04, 0x3C, 0x44, // U+03C0 pi
+	  0x7C, 0x12, 0x12, 0x12, 0x0C, // U+03C1 rho
+	  0x08, 0x14, 0x54, 0x54, 0x24, // U+03C2 final sigma
+	  0x38, 0x44, 0x44, 0x4C, 0x34, // U+03C3 sigma
+	  0x04, 0x04, 0x3C, 0x44, 0x24, // U+03C4 tau
+	  0x3C, 0x40, 0x40, 0x40, 0x3C, // U+03C5 upsilon
+	  0x18, 0x24, 0x7E, 0x24, 0x18, // U+03C6 phi
+	  0x44, 0x28, 0x10, 0x28, 0x44, // U+03C7 chi
+	  0x0E, 0x10, 0x7E, 0x10, 0x0E, // U+03C8 psi
+	  0x38, 0x44, 0x30, 0x44, 0x38, // U+03C9 omega
+	  0x00, 0x08, 0x08, 0x08, 0x00, // U+2013 en dash
+	  0x08, 0x08, 0x08, 0x08, 0x08, // U+2014 em dash
+	  0x00, 0x00, 0x00, 0x0E, 0x0D, // U+2018 left single quote
+	  0x0D, 0x0E, 0x00, 0x00, 0x00, // U+2019 right single quote
+	  0x0E, 0x0D, 0x00, 0x0E, 0x0D, // U+201C left double quote
+	  0x0D, 0x0E, 0x00, 0x0D, 0x0E, // U+201D right double quote
+	  0x00, 0x1C, 0x1C, 0x1C, 0x00, // U+2022 bullet
+	  0x20, 0x00, 0x20, 0x00, 0x20, // U+2026 ellipsis
+	  0x14, 0x3E, 0x55, 0x55, 0x41, // U+20AC euro
+	  0x08, 0x1C, 0x2A, 0x08, 0x08, // U+2190 left arrow
+	  0x04, 0x02, 0x7F, 0x02, 0x04, // U+2191 up arrow
+	  0x08, 0x08, 0x2A, 0x1C, 0x08, // U+2192 right arrow
+	  0x10, 0x20, 0x7F, 0x20, 0x10, // U+2193 down arrow
+	  0x08, 0x1C, 0x08, 0x1C, 0x08, // U+2194 left right arrow
+	  0x00, 0x22, 0x7F, 0x22, 0x00, // U+2195 up down arrow
+	  0x08, 0x08, 0x08, 0x08, 0x08, // U+2500 light horizontal
+	  0x00, 0x00, 0x7F, 0x00, 0x00, // U+2502 light vertical
+	  0x00, 0x00, 0x78, 0x08, 0x08, // U+250C light down and right
+	  0x08, 0x08, 0x78, 0x00, 0x00, // U+2510 light down and left
+	  0x00, 0x00, 0x0F, 0x08, 0x08, // U+2514 light up and right
+	  0x08, 0x08, 0x0F, 0x00, 0x00, // U+2518 light up and left
+	  0x00, 0x00, 0x7F, 0x08, 0x08, // U+251C light vertical and right
+	  0x08, 0x08, 0x7F, 0x00, 0x00, // U+2524 light vertical and left
+	  0x08, 0x08, 0x78, 0x08, 0x08, // U+252C light down and horizontal
+	  0x08, 0x08, 0x0F, 0x08, 0x08, // U+2534 light up and horizontal
+	  0x08, 0x08, 0x7F, 0x08, 0x08, // U+253C light cross
+	  0x14, 0x14, 0x14, 0x14, 0x14, // U+2550 double horizontal
+	  0x00, 0x7F, 0x00, 0x7F, 0x00, // U+2551 double vertical
+	  0x00, 0x7C, 0x04, 0x74, 0x14, // U+2554 double down and right
+	  0x14, 0x74, 0x04, 0x7C, 0x00, // U+2557 double down and left
+	  0x00, 0x1F, 0x10, 0x17, 0x14, // U+255A double up and right
+	  0x14, 0x17, 0x10, 0x1F, 0x00, // U+255D double up and left
+	  0x00, 0x7F, 0x00, 0x77, 0x14, // U+2560 double vertical and right
+	  0x14, 0x77, 0x00, 0x7F, 0x00, // U+2563 double vertical and left
+	  0x14, 0x74, 0x04, 0x74, 0x14, // U+2566 double down and horizontal
+	  0x14, 0x17, 0x10, 0x17, 0x14, // U+2569 double up and horizontal
+	  0x14, 0x77, 0x00, 0x77, 0x14, // U+256C double cross
+	  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, // U+2580 upper half block
+	  0x70, 0x70, 0x70, 0x70, 0x70, // U+2584 lower half block
+	  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, // U+2588 full block
+	  0x7F, 0x7F, 0x00, 0x00, 0x00, // U+258C left half block
+	  0x00, 0x00, 0x00, 0x7F, 0x7F, // U+2590 right half block
+	  0x00, 0x55, 0x00, 0x55, 0x00, // U+2591 light shade
+	  0x2A, 0x55, 0x2A, 0x55, 0x2A, // U+2592 medium shade
+	  0x2A, 0x7F, 0x2A, 0x7F, 0x2A, // U+2593 dark shade
+};
+
+const PixieGlyphs PIX_GLYPHS_EXT = {ext_codepoint, ext_col, 208};
+
+#endif
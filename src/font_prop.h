@@ -0,0 +1,135 @@
+// Proportional version of font.h: the blank edge columns of each glyph are
+// trimmed and PIX_FONT_PROP adds one blank column after it instead. The space
+// keeps two columns. Kerning pairs close that gap where the facing edges of
+// two glyphs don't touch, even diagonally.
+
+const uint8_t prop_col[423] PROGMEM = {
+	  0x00, 0x00,                   // (space)  00
+	  0x5F,                         // !        01
+	  0x07, 0x00, 0x07,             // "        02
+	  0x14, 0x7F, 0x14, 0x7F, 0x14, // #        03
+	  0x24, 0x2A, 0x7F, 0x2A, 0x12, // $        04
+	  0x23, 0x13, 0x08, 0x64, 0x62, // %        05
+	  0x36, 0x49, 0x55, 0x22, 0x50, // &        06
+	  0x05, 0x03,                   // '        07
+	  0x1C, 0x22, 0x41,             // (        08
+	  0x41, 0x22, 0x1C,             // )        09
+	  0x08, 0x2A, 0x1C, 0x2A, 0x08, // *        0a
+	  0x08, 0x08, 0x3E, 0x08, 0x08, // +        0b
+	  0x50, 0x30,                   // ,        0c
+	  0x08, 0x08, 0x08, 0x08, 0x08, // -        0d
+	  0x60, 0x60,                   // .        0e
+	  0x20, 0x10, 0x08, 0x04, 0x02, // /        0f
+	  0x3E, 0x51, 0x49, 0x45, 0x3E, // 0        10
+	  0x42, 0x7F, 0x40,             // 1        11
+	  0x42, 0x61, 0x51, 0x49, 0x46, // 2        12
+	  0x21, 0x41, 0x45, 0x4B, 0x31, // 3        13
+	  0x18, 0x14, 0x12, 0x7F, 0x10, // 4        14
+	  0x27, 0x45, 0x45, 0x45, 0x39, // 5        15
+	  0x3C, 0x4A, 0x49, 0x49, 0x30, // 6        16
+	  0x01, 0x71, 0x09, 0x05, 0x03, // 7        17
+	  0x36, 0x49, 0x49, 0x49, 0x36, // 8        18
+	  0x06, 0x49, 0x49, 0x29, 0x1E, // 9        19
+	  0x36, 0x36,                   // :        1a
+	  0x56, 0x36,                   // ;        1b
+	  0x08, 0x14, 0x22, 0x41,       // <        1c
+	  0x14, 0x14, 0x14, 0x14, 0x14, // =        1d
+	  0x41, 0x22, 0x14, 0x08,       // >        1e
+	  0x02, 0x01, 0x51, 0x09, 0x06, // ?        1f
+	  0x32, 0x49, 0x79, 0x41, 0x3E, // @        20
+	  0x7E, 0x11, 0x11, 0x11, 0x7E, // A        21
+	  0x7F, 0x49, 0x49, 0x49, 0x36, // B        22
+	  0x3E, 0x41, 0x41, 0x41, 0x22, // C        23
+	  0x7F, 0x41, 0x41, 0x22, 0x1C, // D        24
+	  0x7F, 0x49, 0x49, 0x49, 0x41, // E        25
+	  0x7F, 0x09, 0x09, 0x01, 0x01, // F        26
+	  0x3E, 0x41, 0x41, 0x51, 0x32, // G        27
+	  0x7F, 0x08, 0x08, 0x08, 0x7F, // H        28
+	  0x41, 0x7F, 0x41,             // I        29
+	  0x20, 0x40, 0x41, 0x3F, 0x01, // J        2a
+	  0x7F, 0x08, 0x14, 0x22, 0x41, // K        2b
+	  0x7F, 0x40, 0x40, 0x40, 0x40, // L        2c
+	  0x7F, 0x02, 0x04, 0x02, 0x7F, // M        2d
+	  0x7F, 0x04, 0x08, 0x10, 0x7F, // N        2e
+	  0x3E, 0x41, 0x41, 0x41, 0x3E, // O        2f
+	  0x7F, 0x09, 0x09, 0x09, 0x06, // P        30
+	  0x3E, 0x41, 0x51, 0x21, 0x5E, // Q        31
+	  0x7F, 0x09, 0x19, 0x29, 0x46, // R        32
+	  0x46, 0x49, 0x49, 0x49, 0x31, // S        33
+	  0x01, 0x01, 0x7F, 0x01, 0x01, // T        34
+	  0x3F, 0x40, 0x40, 0x40, 0x3F, // U        35
+	  0x1F, 0x20, 0x40, 0x20, 0x1F, // V        36
+	  0x7F, 0x20, 0x18, 0x20, 0x7F, // W        37
+	  0x63, 0x14, 0x08, 0x14, 0x63, // X        38
+	  0x03, 0x04, 0x78, 0x04, 0x03, // Y        39
+	  0x61, 0x51, 0x49, 0x45, 0x43, // Z        3a
+	  0x7F, 0x41, 0x41,             // [        3b
+	  0x02, 0x04, 0x08, 0x10, 0x20, // "\"      3c
+	  0x41, 0x41, 0x7F,             // ]        3d
+	  0x04, 0x02, 0x01, 0x02, 0x04, // ^        3e
+	  0x40, 0x40, 0x40, 0x40, 0x40, // _        3f
+	  0x01, 0x02, 0x04,             // `        40
+	  0x20, 0x54, 0x54, 0x54, 0x78, // a        41
+	  0x7F, 0x48, 0x44, 0x44, 0x38, // b        42
+	  0x38, 0x44, 0x44, 0x44, 0x20, // c        43
+	  0x38, 0x44, 0x44, 0x48, 0x7F, // d        44
+	  0x38, 0x54, 0x54, 0x54, 0x18, // e        45
+	  0x08, 0x7E, 0x09, 0x01, 0x02, // f        46
+	  0x08, 0x14, 0x54, 0x54, 0x3C, // g        47
+	  0x7F, 0x08, 0x04, 0x04, 0x78, // h        48
+	  0x44, 0x7D, 0x40,             // i        49
+	  0x20, 0x40, 0x44, 0x3D,       // j        4a
+	  0x7F, 0x10, 0x28, 0x44,       // k        4b
+	  0x41, 0x7F, 0x40,             // l        4c
+	  0x7C, 0x04, 0x18, 0x04, 0x78, // m        4d
+	  0x7C, 0x08, 0x04, 0x04, 0x78, // n        4e
+	  0x38, 0x44, 0x44, 0x44, 0x38, // o        4f
+	  0x7C, 0x14, 0x14, 0x14, 0x08, // p        50
+	  0x08, 0x14, 0x14, 0x18, 0x7C, // q        51
+	  0x7C, 0x08, 0x04, 0x04, 0x08, // r        52
+	  0x48, 0x54, 0x54, 0x54, 0x20, // s        53
+	  0x04, 0x3F, 0x44, 0x40, 0x20, // t        54
+	  0x3C, 0x40, 0x40, 0x20, 0x7C, // u        55
+	  0x1C, 0x20, 0x40, 0x20, 0x1C, // v        56
+	  0x3C, 0x40, 0x30, 0x40, 0x3C, // w        57
+	  0x44, 0x28, 0x10, 0x28, 0x44, // x        58
+	  0x0C, 0x50, 0x50, 0x50, 0x3C, // y        59
+	  0x44, 0x64, 0x54, 0x4C, 0x44, // z        5a
+	  0x08, 0x36, 0x41,             // {        5b
+	  0x7F,                         // |        5c
+	  0x41, 0x36, 0x08,             // }        5d
+	  0x08, 0x08, 0x2A, 0x1C, 0x08, // ~        5e
+	  0x00, 0x00,                   // (del)    5f
+};
+
+// Start of each glyph in prop_col[], the last entry is the end of the table
+const uint16_t prop_offset[97] PROGMEM = {
+	    0,   2,   3,   6,  11,  16,  21,  26,  28,  31,  34,  39,
+	   44,  46,  51,  53,  58,  63,  66,  71,  76,  81,  86,  91,
+	   96, 101, 106, 108, 110, 114, 119, 123, 128, 133, 138, 143,
+	  148, 153, 158, 163, 168, 173, 176, 181, 186, 191, 196, 201,
+	  206, 211, 216, 221, 226, 231, 236, 241, 246, 251, 256, 261,
+	  264, 269, 272, 277, 282, 285, 290, 295, 300, 305, 310, 315,
+	  320, 325, 328, 332, 336, 339, 344, 349, 354, 359, 364, 369,
+	  374, 379, 384, 389, 394, 399, 404, 409, 412, 413, 416, 421,
+	  423
+};
+
+// {left, right, adjust} sorted by pair, 0 terminated
+const int8_t prop_kerning[274] PROGMEM = {
+	  '"',',',-1, '"','.',-1, '"','J',-1, '"','a',-1, '\'',',',-1, '\'','-',-1, '\'','.',-1, '\'','J',-1,
+	  '\'','a',-1, '\'','c',-1, '\'','d',-1, '\'','e',-1, '\'','g',-1, '\'','o',-1, '\'','q',-1, '\'','s',-1,
+	  'F',',',-1, 'F','-',-1, 'F','.',-1, 'F','J',-1, 'F','a',-1, 'F','c',-1, 'F','d',-1, 'F','e',-1,
+	  'F','g',-1, 'F','m',-1, 'F','n',-1, 'F','o',-1, 'F','p',-1, 'F','q',-1, 'F','r',-1, 'F','s',-1,
+	  'F','u',-1, 'F','v',-1, 'F','w',-1, 'F','x',-1, 'F','y',-1, 'F','z',-1, 'L','"',-1, 'L','\'',-1,
+	  'L','-',-1, 'L','T',-1, 'L','V',-1, 'L','Y',-1, 'L','g',-1, 'L','q',-1, 'L','v',-1, 'L','y',-1,
+	  'P',',',-1, 'P','.',-1, 'P','J',-1, 'P','a',-1, 'T',',',-1, 'T','-',-1, 'T','.',-1, 'T','J',-1,
+	  'T','a',-1, 'T','c',-1, 'T','d',-1, 'T','e',-1, 'T','g',-1, 'T','m',-1, 'T','n',-1, 'T','o',-1,
+	  'T','p',-1, 'T','q',-1, 'T','r',-1, 'T','s',-1, 'T','u',-1, 'T','v',-1, 'T','w',-1, 'T','x',-1,
+	  'T','y',-1, 'T','z',-1, 'Y',',',-1, 'Y','-',-1, 'Y','.',-1, 'Y','J',-1, 'Y','a',-1, 'Y','c',-1,
+	  'Y','d',-1, 'Y','e',-1, 'Y','g',-1, 'Y','o',-1, 'Y','q',-1, 'Y','s',-1, 'r','.',-1, 'r','J',-1,
+	  'r','T',-1, 'r','Y',-1, 'r','a',-1,
+	  0
+};
+
+const PixieFont PIX_FONT_PROP = {prop_col, prop_offset, prop_kerning, 32, 96, 1};